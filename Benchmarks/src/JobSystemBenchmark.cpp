@@ -0,0 +1,209 @@
+// JobSystem micro-benchmark: per-job scheduling overhead and ParallelFor scaling
+// from 2 to N threads (N = hardware threads, or the first argument), next to the
+// shared-counter pool the job system replaced, run on the same loops.
+
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static const uint32_t EmptyJobCount = 100000;
+static const uint32_t WorkItemCount = 1 << 20;
+static const uint32_t Repeats = 5;
+
+// The previous JobSystem: one loop at a time, every index handed out through a
+// single shared atomic counter. Kept here as the reference point.
+class SharedCounterPool {
+public:
+    SharedCounterPool(uint32_t workerCount) {
+        for (uint32_t i = 0; i < workerCount; i++)
+            m_Workers.emplace_back([this] { WorkerLoop(); });
+    }
+
+    ~SharedCounterPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_WorkReady.notify_all();
+
+        for (std::thread& worker : m_Workers)
+            worker.join();
+    }
+
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func) {
+        if (count == 0)
+            return;
+
+        if (m_Workers.empty() || count == 1) {
+            for (uint32_t i = 0; i < count; i++)
+                func(i);
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WorkDone.wait(lock, [this] { return m_Active == 0; });
+
+            m_Func = &func;
+            m_Count = count;
+            m_Next = 0;
+            m_Completed = 0;
+            m_Generation++;
+        }
+        m_WorkReady.notify_all();
+
+        RunItems();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_WorkDone.wait(lock, [this] { return m_Completed == m_Count && m_Active == 0; });
+        m_Func = nullptr;
+    }
+
+private:
+    void RunItems() {
+        uint32_t done = 0;
+        for (uint32_t i = m_Next++; i < m_Count; i = m_Next++) {
+            (*m_Func)(i);
+            done++;
+        }
+        m_Completed += done;
+    }
+
+    void WorkerLoop() {
+        uint64_t seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WorkReady.wait(lock, [&] { return m_Stopping || m_Generation != seen; });
+                if (m_Stopping)
+                    return;
+
+                seen = m_Generation;
+                m_Active++;
+            }
+
+            RunItems();
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Active--;
+            }
+            m_WorkDone.notify_all();
+        }
+    }
+
+    std::vector<std::thread> m_Workers;
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkReady;
+    std::condition_variable m_WorkDone;
+
+    const std::function<void(uint32_t)>* m_Func = nullptr;
+    uint32_t m_Count = 0;
+    std::atomic<uint32_t> m_Next{ 0 };
+    std::atomic<uint32_t> m_Completed{ 0 };
+
+    uint64_t m_Generation = 0;
+    uint32_t m_Active = 0;
+    bool m_Stopping = false;
+};
+
+static double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Best of several runs, to keep scheduler noise out of the numbers
+template<typename Func>
+static double BestOf(const Func& func) {
+    double best = 1e30;
+    for (uint32_t i = 0; i < Repeats; i++) {
+        Clock::time_point start = Clock::now();
+        func();
+        best = std::min(best, ElapsedMs(start));
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    Engine::Logger::Init();
+
+    uint32_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    if (argc > 1)
+        maxThreads = std::max(std::atoi(argv[1]), 1);
+
+    std::vector<float> output(WorkItemCount);
+    auto work = [&](uint32_t i) {
+        float x = (float)i;
+        for (int k = 0; k < 32; k++)
+            x = std::sqrt(x + (float)k) * 1.0001f;
+        output[i] = x;
+    };
+    auto empty = [](uint32_t) {};
+
+    // Both pools run everything inline with a single thread, so that case is only
+    // measured once, as the plain loop the speedups are relative to
+    double serialMs = BestOf([&] {
+        for (uint32_t i = 0; i < WorkItemCount; i++)
+            work(i);
+    });
+    std::printf("\nserial loop (1 thread, baseline): %.2f ms\n", serialMs);
+
+    if (maxThreads < 2) {
+        std::printf("only one thread available, nothing to compare\n");
+        std::printf("\nchecksum %f\n", output[WorkItemCount / 2]);
+        return 0;
+    }
+
+    // "jobs" = JobSystem, "pool" = SharedCounterPool, both on the same loops
+    std::printf("\n%8s %14s %24s %24s %20s\n", "", "Run", "empty ParallelFor", "ParallelFor", "speedup");
+    std::printf("%8s %14s %11s %12s %11s %12s %9s %10s\n", "threads", "jobs ns/job",
+                "jobs ns/it", "pool ns/it", "jobs ms", "pool ms", "jobs", "pool");
+
+    for (uint32_t threads = 2; threads <= maxThreads; threads++) {
+        double runMs, jobsEmptyMs, jobsForMs;
+        {
+            Engine::JobSystem::Init(threads - 1);
+
+            // Individually submitted empty jobs on one counter
+            runMs = BestOf([] {
+                Engine::JobCounter counter;
+                for (uint32_t i = 0; i < EmptyJobCount; i++)
+                    Engine::JobSystem::Run([] {}, &counter);
+                Engine::JobSystem::Wait(counter);
+            });
+
+            jobsEmptyMs = BestOf([&] { Engine::JobSystem::ParallelFor(EmptyJobCount, empty); });
+            jobsForMs = BestOf([&] { Engine::JobSystem::ParallelFor(WorkItemCount, work); });
+
+            Engine::JobSystem::Shutdown();
+        }
+
+        double poolEmptyMs, poolForMs;
+        {
+            SharedCounterPool pool(threads - 1);
+            poolEmptyMs = BestOf([&] { pool.ParallelFor(EmptyJobCount, empty); });
+            poolForMs = BestOf([&] { pool.ParallelFor(WorkItemCount, work); });
+        }
+
+        std::printf("%8u %14.1f %11.1f %12.1f %11.2f %12.2f %8.2fx %9.2fx\n", threads,
+                    runMs * 1e6 / EmptyJobCount,
+                    jobsEmptyMs * 1e6 / EmptyJobCount, poolEmptyMs * 1e6 / EmptyJobCount,
+                    jobsForMs, poolForMs, serialMs / jobsForMs, serialMs / poolForMs);
+    }
+
+    // Keeps the work loop from being optimized away
+    std::printf("\nchecksum %f\n", output[WorkItemCount / 2]);
+    return 0;
+}
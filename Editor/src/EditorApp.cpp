@@ -317,8 +317,12 @@ public:
         ImVec2 viewportPanelSize = ImGui::GetContentRegionAvail();
         m_ViewportSize = { viewportPanelSize.x, viewportPanelSize.y };
         
+        // The framebuffer only renders into the bottom-left corner of its attachments
         uint64_t textureID = m_Framebuffer->GetColorAttachmentRendererID();
-        ImGui::Image(reinterpret_cast<void*>(textureID), ImVec2{ m_ViewportSize.x, m_ViewportSize.y }, ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+        const auto& fbSpec = m_Framebuffer->GetSpecification();
+        float u = (float)fbSpec.Width / m_Framebuffer->GetCapacityWidth();
+        float v = (float)fbSpec.Height / m_Framebuffer->GetCapacityHeight();
+        ImGui::Image(reinterpret_cast<void*>(textureID), ImVec2{ m_ViewportSize.x, m_ViewportSize.y }, ImVec2{ 0, v }, ImVec2{ u, 0 });
         
             ImGui::End();
             ImGui::PopStyleVar();
@@ -332,8 +336,31 @@ public:
         ImGui::Separator();
         ImGui::Text("Draw Calls: %d", stats.DrawCalls);
         ImGui::Text("Quads: %d", stats.QuadCount);
+        ImGui::Text("Circles: %d", stats.CircleCount);
+        ImGui::Text("Lines: %d", stats.LineCount);
+        ImGui::Text("Opaque / Transparent: %d / %d", stats.OpaqueQuadCount, stats.TransparentQuadCount);
+        ImGui::Text("Overdraw: %.2fx", stats.Overdraw);
+        ImGui::Text("Culled: %d", stats.CulledCount);
+        ImGui::Text("Text Layouts: %d", stats.TextLayouts);
+        ImGui::Text("Texture Array Switches: %d", stats.TextureArraySwitches);
         ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
         ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+        ImGui::Text("Texture Slot Lookups: %d", stats.TextureSlotLookups);
+        ImGui::Text("Slot Exhaustion Breaks: %d", stats.SlotExhaustionBatchBreaks);
+        ImGui::Text("Primitive Switches: %d", stats.PrimitiveSwitches);
+        auto stateChanges = Engine::RenderCommand::GetStateChangeStats();
+        ImGui::Text("State Changes: %d issued, %d redundant", stateChanges.Issued, stateChanges.Redundant);
+        ImGui::Text("Pending Textures: %d", Engine::TextureUploadQueue::GetPendingCount());
+        const char* submissionModes[] = { "Immediate", "Sorted", "Layered" };
+        int submissionMode = (int)Engine::Renderer2D::GetSubmissionMode();
+        if (ImGui::Combo("Submission", &submissionMode, submissionModes, IM_ARRAYSIZE(submissionModes)))
+            Engine::Renderer2D::SetSubmissionMode((Engine::Renderer2D::SubmissionMode)submissionMode);
+        bool instanced = Engine::Renderer2D::IsInstancingEnabled();
+        if (ImGui::Checkbox("Instanced Quads", &instanced))
+            Engine::Renderer2D::SetInstancingEnabled(instanced);
+        bool physicsDebugDraw = Engine::Physics2D::IsDebugDrawEnabled();
+        if (ImGui::Checkbox("Physics Debug Draw", &physicsDebugDraw))
+            Engine::Physics2D::SetDebugDraw(physicsDebugDraw);
         ImGui::Separator();
             ImGui::Text("Viewport Size: %.0fx%.0f", m_ViewportSize.x, m_ViewportSize.y);
             ImGui::End();
@@ -9,15 +9,24 @@
 #include "Engine/Core/TimeStep.h"
 #include "Engine/Core/Window.h"
 #include "Engine/Core/Input.h"
+#include "Engine/Core/JobSystem.h"
 
 // Renderer
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/NullRenderer.h"
 #include "Engine/Renderer/Buffer.h"
 #include "Engine/Renderer/Shader.h"
 #include "Engine/Renderer/Texture.h"
 #include "Engine/Renderer/SubTexture2D.h"
+#include "Engine/Renderer/TextureAtlas.h"
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/TextureArrayAllocator.h"
+#include "Engine/Renderer/TextureUploadQueue.h"
+#include "Engine/Renderer/CompressedImage.h"
 #include "Engine/Renderer/Framebuffer.h"
+#include "Engine/Renderer/RenderTargetPool.h"
 #include "Engine/Renderer/OrthographicCamera.h"
 #include "Engine/Renderer/CameraController.h"
 #include "Engine/Renderer/ParticleSystem.h"
@@ -27,6 +36,7 @@
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Components.h"
 #include "Engine/Scene/SceneSerializer.h"
+#include "Engine/Scene/SystemScheduler.h"
 
 // Assets
 #include "Engine/Assets/AssetManager.h"
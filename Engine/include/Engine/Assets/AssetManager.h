@@ -2,6 +2,7 @@
 
 #include "Engine/Core/Base.h"
 #include "Engine/Renderer/Texture.h"
+#include "Engine/Renderer/TextureAtlas.h"
 #include "Engine/Renderer/Shader.h"
 
 namespace Engine {
@@ -9,11 +10,20 @@ namespace Engine {
     class AssetManager {
     public:
         // Textures
-        static Ref<Texture2D> LoadTexture(const std::string& name, const std::string& path);
+        static Ref<Texture2D> LoadTexture(const std::string& name, const std::string& path,
+                                          const TextureSpecification& specification = TextureSpecification());
+        // Returns a placeholder at once, see Texture::IsReady
+        static Ref<Texture2D> LoadTextureAsync(const std::string& name, const std::string& path,
+                                               const TextureSpecification& specification = TextureSpecification());
         static Ref<Texture2D> GetTexture(const std::string& name);
         static bool HasTexture(const std::string& name);
         static void UnloadTexture(const std::string& name);
         
+        // Sprites, packed into shared atlas pages as they load
+        static Ref<SubTexture2D> LoadSprite(const std::string& name, const std::string& path);
+        static Ref<SubTexture2D> GetSprite(const std::string& name);
+        static bool HasSprite(const std::string& name);
+        
         // Shaders
         static Ref<Shader> LoadShader(const std::string& name, const std::string& path);
         static Ref<Shader> GetShader(const std::string& name);
@@ -26,13 +36,18 @@ namespace Engine {
         // Statistics
         struct Stats {
             uint32_t TexturesLoaded = 0;
+            uint32_t SpritesLoaded = 0;
+            uint32_t AtlasPages = 0;
             uint32_t ShadersLoaded = 0;
-            uint64_t EstimatedMemoryUsage = 0;
+            uint64_t MemoryUsage = 0;   // Texture and atlas storage including mips
+            std::unordered_map<ImageFormat, uint64_t> MemoryByFormat;
         };
         static Stats GetStats();
         
     private:
         static std::unordered_map<std::string, Ref<Texture2D>> s_Textures;
+        static std::unordered_map<std::string, Ref<SubTexture2D>> s_Sprites;
+        static Scope<TextureAtlas> s_SpriteAtlas;
         static std::unordered_map<std::string, Ref<Shader>> s_Shaders;
     };
 
@@ -6,16 +6,19 @@
 #include "Engine/Core/Layer.h"
 #include "Engine/Events/Event.h"
 #include "Engine/Events/ApplicationEvent.h"
+#include "Engine/Renderer/RendererAPI.h"
 #include <vector>
 
 namespace Engine {
 
     class Application {
     public:
-        Application(const std::string& name = "Game Engine");
+        // Pass RendererAPI::API::Null to run without a GLFW window or GL context
+        Application(const std::string& name = "Game Engine", RendererAPI::API api = RendererAPI::API::OpenGL);
         virtual ~Application();
         
         void Run();
+        void Close() { m_Running = false; }
         
         void OnEvent(Event& e);
         
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace Engine {
+
+    struct QueuedJob;
+
+    // Counts unfinished jobs. Starting a job with a counter raises it and each of its
+    // parents; they drop again once the job returns. Waiting on a parent therefore
+    // also waits for jobs started on its child counters. A counter must outlive its
+    // jobs and can be reused once it reaches zero.
+    class JobCounter {
+    public:
+        JobCounter(JobCounter* parent = nullptr)
+            : m_Parent(parent) {}
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        std::atomic<uint32_t> m_Pending{ 0 };
+        JobCounter* m_Parent;
+
+        friend class JobSystem;
+    };
+
+    // Worker pool with one job deque per thread. A thread pushes and pops at the back
+    // of its own deque and, when that runs dry, steals from the front of another's.
+    // The calling thread has a deque too and runs jobs while it waits, so jobs can
+    // start and wait for jobs of their own, and everything still runs (serially)
+    // before Init or with no workers. Threads outside the pool share the main
+    // thread's deque.
+    class JobSystem {
+    public:
+        using Job = std::function<void()>;
+        using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+        // 0 = one worker per hardware thread, minus the main thread
+        static void Init(uint32_t workerCount = 0);
+        // Call with no jobs in flight
+        static void Shutdown();
+
+        static uint32_t GetWorkerCount();
+
+        static void Run(const Job& job, JobCounter* counter = nullptr);
+        // Runs queued jobs on this thread until the counter reaches zero
+        static void Wait(JobCounter& counter);
+
+        // Calls func(begin, end) over batches covering [0, count) and returns once all
+        // of them finished. 0 picks a batch size that gives each thread a few batches.
+        static void ParallelForRange(uint32_t count, uint32_t batchSize, const RangeFunction& func);
+
+        // Calls func(i) for every i in [0, count) and returns once all calls finished.
+        // Calls may run in any order and on any thread.
+        static void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func);
+
+        // Calls func(entity) for every entity in an entt view. The view is copied to a
+        // list first; func must not add or remove components or entities.
+        template<typename View, typename Func>
+        static void ParallelForEach(const View& view, const Func& func, uint32_t batchSize = 0) {
+            std::vector<typename View::entity_type> entities(view.begin(), view.end());
+            ParallelForRange((uint32_t)entities.size(), batchSize, [&](uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; i++)
+                    func(entities[i]);
+            });
+        }
+
+    private:
+        JobSystem() = default;
+
+        static void Execute(QueuedJob& job);
+        static void WorkerLoop(uint32_t queueIndex);
+    };
+
+} // namespace Engine
@@ -36,6 +36,9 @@ namespace Engine {
         
         virtual void* GetNativeWindow() const = 0;
         
+        // Seconds since the window was created
+        virtual float GetTime() const = 0;
+        
         static Scope<Window> Create(const WindowProps& props = WindowProps());
     };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Core/Base.h"
+#include "Engine/Renderer/GPUTimer.h"
 #include <string>
 #include <chrono>
 #include <vector>
@@ -12,6 +13,7 @@ namespace Engine {
         std::string Name;
         float Duration; // in milliseconds
         size_t Depth;
+        bool GPU = false; // Latest reading of a GPU pass, a few frames old
     };
 
     class Profiler {
@@ -23,6 +25,19 @@ namespace Engine {
 
         void BeginProfile(const std::string& name);
         void EndProfile();
+        // Result timed elsewhere, e.g. on a worker thread, nested in the open scope.
+        // Main thread only, like the rest of the profiler.
+        void AddResult(const std::string& name, float duration);
+
+        // GPU passes, timed with GL queries. Passes can't nest; results show up in
+        // GetResults a few frames later, one entry per pass name.
+        void BeginGPUPass(const std::string& name);
+        void EndGPUPass();
+        
+        // Reads back finished GPU passes; call once per frame after rendering
+        void EndFrame();
+        // Releases GPU queries; call before the graphics context goes away
+        void Shutdown();
 
         const std::vector<ProfileResult>& GetResults() const { return m_Results; }
         void ClearResults() { m_Results.clear(); }
@@ -43,6 +58,9 @@ namespace Engine {
         std::vector<ProfileResult> m_Results;
         float m_FrameTime = 0.0f;
         size_t m_CurrentDepth = 0;
+        
+        Scope<GPUTimer> m_GPUTimer; // Created on first use
+        std::vector<GPUTimerResult> m_GPUResults;
     };
 
     // RAII profile scope
@@ -61,14 +79,32 @@ namespace Engine {
         std::string m_Name;
     };
 
+    // RAII scope timed on both the CPU and the GPU
+    class GPUProfileScope {
+    public:
+        GPUProfileScope(const std::string& name)
+            : m_CPUScope(name) {
+            Profiler::Get().BeginGPUPass(name);
+        }
+
+        ~GPUProfileScope() {
+            Profiler::Get().EndGPUPass();
+        }
+
+    private:
+        ProfileScope m_CPUScope;
+    };
+
 } // namespace Engine
 
 // Profiling macros
 #ifdef GE_ENABLE_PROFILING
     #define GE_PROFILE_SCOPE(name) Engine::ProfileScope profileScope##__LINE__(name)
     #define GE_PROFILE_FUNCTION() GE_PROFILE_SCOPE(__FUNCTION__)
+    #define GE_PROFILE_GPU_SCOPE(name) Engine::GPUProfileScope gpuProfileScope##__LINE__(name)
 #else
     #define GE_PROFILE_SCOPE(name)
     #define GE_PROFILE_FUNCTION()
+    #define GE_PROFILE_GPU_SCOPE(name)
 #endif
 
@@ -21,6 +21,10 @@ namespace Engine {
         static void Init();
         static void Shutdown();
         
+        // World used by Raycast and debug drawing, set by the running scene (b2World*)
+        static void SetWorld(void* world);
+        static void* GetWorld();
+        
         static void SetGravity(const glm::vec2& gravity);
         static glm::vec2 GetGravity();
         
@@ -31,8 +35,23 @@ namespace Engine {
         static void Step(float timestep, int32_t velocityIterations = 8, int32_t positionIterations = 3);
         
         // Debug rendering
+        struct DebugDrawOptions {
+            bool Shapes = true;
+            bool AABBs = false;
+            bool Joints = false;
+            bool CenterOfMass = false;
+            bool Raycasts = true;   // Rays cast since the last DrawDebug, green up to the hit
+        };
+        
         static void SetDebugDraw(bool enabled);
         static bool IsDebugDrawEnabled();
+        static void SetDebugDrawOptions(const DebugDrawOptions& options);
+        static const DebugDrawOptions& GetDebugDrawOptions();
+        
+        // Outlines the world through Renderer2D's line batch. Call between
+        // Renderer2D::BeginScene and EndScene, in a scene after the main one to stay on
+        // top; does nothing while debug draw is off.
+        static void DrawDebug();
         
     private:
         static void* s_PhysicsWorld;
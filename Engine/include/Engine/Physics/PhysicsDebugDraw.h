@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include <box2d/box2d.h>
+
+namespace Engine {
+
+    // Feeds Box2D debug drawing into the Renderer2D line batch. Solid shapes are drawn
+    // as outlines too, so a whole world costs one or two draw calls.
+    class PhysicsDebugDraw : public b2Draw {
+    public:
+        // In front of anything the scene draws
+        static constexpr float DepthZ = 0.99f;
+        
+        void DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override;
+        void DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) override;
+        void DrawCircle(const b2Vec2& center, float radius, const b2Color& color) override;
+        void DrawSolidCircle(const b2Vec2& center, float radius, const b2Vec2& axis, const b2Color& color) override;
+        void DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color) override;
+        void DrawTransform(const b2Transform& xf) override;
+        void DrawPoint(const b2Vec2& p, float size, const b2Color& color) override;
+    };
+
+}
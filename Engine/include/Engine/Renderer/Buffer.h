@@ -6,7 +6,10 @@
 namespace Engine {
 
     enum class ShaderDataType {
-        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+        None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+        // Packed vertex data. Set Normalized to read UByte4/UShort2 as [0, 1] floats;
+        // unnormalized they (and UInt) reach the shader as integers.
+        UByte4, UShort2, UInt
     };
 
     static uint32_t ShaderDataTypeSize(ShaderDataType type) {
@@ -22,6 +25,9 @@ namespace Engine {
             case ShaderDataType::Int3:     return 4 * 3;
             case ShaderDataType::Int4:     return 4 * 4;
             case ShaderDataType::Bool:     return 1;
+            case ShaderDataType::UByte4:   return 1 * 4;
+            case ShaderDataType::UShort2:  return 2 * 2;
+            case ShaderDataType::UInt:     return 4;
             default: break;
         }
         
@@ -35,11 +41,12 @@ namespace Engine {
         uint32_t Size;
         uint32_t Offset;
         bool Normalized;
+        uint32_t Divisor; // 0 = per vertex, N = advance once every N instances
         
         BufferElement() = default;
         
-        BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
-            : Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized) {
+        BufferElement(ShaderDataType type, const std::string& name, bool normalized = false, uint32_t divisor = 0)
+            : Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized), Divisor(divisor) {
         }
         
         uint32_t GetComponentCount() const {
@@ -55,6 +62,9 @@ namespace Engine {
                 case ShaderDataType::Int3:    return 3;
                 case ShaderDataType::Int4:    return 4;
                 case ShaderDataType::Bool:    return 1;
+                case ShaderDataType::UByte4:  return 4;
+                case ShaderDataType::UShort2: return 2;
+                case ShaderDataType::UInt:    return 1;
                 default: break;
             }
             
@@ -112,6 +122,25 @@ namespace Engine {
         static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
     };
 
+    // Ring buffer written in place by the CPU. Batches are packed back to back and the
+    // ring is fenced per region, not per batch, so a new batch never overwrites data
+    // the GPU may still be reading and small batches don't use up the ring.
+    class StreamingVertexBuffer : public VertexBuffer {
+    public:
+        virtual ~StreamingVertexBuffer() = default;
+        
+        // Returns room for up to GetRegionSize() bytes after the last committed batch.
+        // Calling again before Commit returns the same pointer.
+        virtual void* BeginWrite() = 0;
+        // Publishes the first size bytes, returns their byte offset in the buffer. Write
+        // whole vertices so offsets stay a multiple of the vertex size.
+        virtual uint32_t Commit(uint32_t size) = 0;
+        
+        virtual uint32_t GetRegionSize() const = 0;
+        
+        static Ref<StreamingVertexBuffer> Create(uint32_t regionSize, uint32_t regionCount = 3);
+    };
+
     class IndexBuffer {
     public:
         virtual ~IndexBuffer() = default;
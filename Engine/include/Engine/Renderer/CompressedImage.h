@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    // Block-compressed image and its mip chain as written by scripts/cook_textures.sh.
+    // Rows are expected bottom first like every other texture in the engine, so the
+    // cook step flips images before compressing them.
+    struct CompressedImage {
+        struct Level {
+            uint32_t Width, Height;
+            uint64_t Offset, Size;  // Byte range in Data
+        };
+        
+        ImageFormat Format = ImageFormat::None;
+        uint32_t Width = 0, Height = 0;
+        std::vector<Level> Levels;
+        std::vector<uint8_t> Data;
+        
+        static bool IsCompressedPath(const std::string& path);
+        
+        // Reads BC1/BC3 DDS files with a legacy DXT1/DXT5 FourCC and BC1/BC3/BC7 files
+        // with a DX10 header. Logs and returns false for anything else.
+        static bool LoadDDS(const std::string& path, CompressedImage& outImage);
+    };
+
+}
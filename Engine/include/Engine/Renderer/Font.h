@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    // One glyph of laid-out text. Layout space has its origin at the left end of the
+    // first baseline, +y up, and one unit per line height.
+    struct GlyphQuad {
+        glm::vec2 Min, Max;
+        glm::vec2 TexMin, TexMax;
+    };
+
+    // Bitmap font baked offline in the AngelCode BMFont text format (.fnt), with a
+    // single page image next to it. Glyphs should be white on transparent so the
+    // text color can tint them.
+    class Font {
+    public:
+        struct Glyph {
+            glm::vec2 TexMin, TexMax;
+            glm::vec2 Offset;  // Pen position to the glyph's bottom-left, pixels, +y up
+            glm::vec2 Size;    // Pixels
+            float Advance;
+        };
+
+        Font(const std::string& filepath);
+
+        bool IsLoaded() const { return m_Atlas != nullptr; }
+        const Ref<Texture2D>& GetAtlas() const { return m_Atlas; }
+        float GetLineHeight() const { return m_LineHeight; }
+        const std::string& GetFilepath() const { return m_Filepath; }
+
+        const Glyph* GetGlyph(uint32_t codepoint) const;
+        float GetKerning(uint32_t first, uint32_t second) const;
+
+        // Appends one quad per visible glyph of UTF-8 text; '\n' starts a new line.
+        // Codepoints missing from the font fall back to '?'.
+        void Layout(const std::string& text, std::vector<GlyphQuad>& outQuads) const;
+
+        // Factory method
+        static Ref<Font> Create(const std::string& filepath);
+
+    private:
+        bool LoadBMFont(const std::string& filepath);
+
+    private:
+        std::string m_Filepath;
+        Ref<Texture2D> m_Atlas;
+        float m_LineHeight = 0.0f;
+        float m_Base = 0.0f; // Top of the line to the baseline, pixels
+        std::unordered_map<uint32_t, Glyph> m_Glyphs;
+        std::unordered_map<uint64_t, float> m_Kerning;
+    };
+
+}
@@ -1,15 +1,53 @@
 #pragma once
 
 #include "Engine/Core/Base.h"
+#include <initializer_list>
+#include <vector>
 
 namespace Engine {
 
+    enum class FramebufferTextureFormat {
+        None = 0,
+
+        // Color
+        RGBA8,
+        RGBA16F,        // HDR color
+        RedInteger,     // 32-bit signed int, e.g. entity IDs for mouse picking
+
+        // Depth/stencil
+        Depth24Stencil8,
+
+        Depth = Depth24Stencil8
+    };
+
+    struct FramebufferTextureSpecification {
+        FramebufferTextureSpecification() = default;
+        FramebufferTextureSpecification(FramebufferTextureFormat format)
+            : TextureFormat(format) {}
+
+        FramebufferTextureFormat TextureFormat = FramebufferTextureFormat::None;
+    };
+
+    // Color attachments are numbered in the order they are listed; at most one depth
+    // attachment. A list with only a depth attachment makes a depth-only target.
+    struct FramebufferAttachmentSpecification {
+        FramebufferAttachmentSpecification() = default;
+        FramebufferAttachmentSpecification(std::initializer_list<FramebufferTextureSpecification> attachments)
+            : Attachments(attachments) {}
+
+        std::vector<FramebufferTextureSpecification> Attachments;
+    };
+
     struct FramebufferSpecification {
         uint32_t Width = 0, Height = 0;
+        FramebufferAttachmentSpecification Attachments = { FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::Depth };
         uint32_t Samples = 1;
         bool SwapChainTarget = false; // false = render to texture
     };
 
+    // Attachments are allocated with spare capacity: resizing within it only changes
+    // the viewport, and growing past it reallocates with geometric headroom. Readers
+    // of an attachment texture therefore sample only GetWidth/GetCapacityWidth of it.
     class Framebuffer {
     public:
         virtual ~Framebuffer() = default;
@@ -18,13 +56,26 @@ namespace Engine {
         virtual void Unbind() = 0;
 
         virtual void Resize(uint32_t width, uint32_t height) = 0;
+        // Integer attachments only
+        virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) = 0;
+        virtual void ClearAttachment(uint32_t attachmentIndex, int value) = 0;
+
+        virtual uint32_t GetColorAttachmentRendererID(uint32_t index = 0) const = 0;
+        virtual uint32_t GetDepthAttachmentRendererID() const = 0;
+
+        // Allocated size of the attachments, at least the specification's size
+        virtual uint32_t GetCapacityWidth() const = 0;
+        virtual uint32_t GetCapacityHeight() const = 0;
 
-        virtual uint32_t GetColorAttachmentRendererID() const = 0;
-        
         virtual const FramebufferSpecification& GetSpecification() const = 0;
 
         static Ref<Framebuffer> Create(const FramebufferSpecification& spec);
+
+        static const uint32_t MaxSize = 8192;
+
+        // New capacity for a requested size: unchanged while it fits and is not
+        // wastefully large, otherwise the request plus 50% headroom
+        static uint32_t ComputeCapacity(uint32_t capacity, uint32_t requested);
     };
 
 } // namespace Engine
-
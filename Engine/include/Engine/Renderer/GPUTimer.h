@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    struct GPUTimerResult {
+        std::string Name;
+        float Duration; // in milliseconds
+    };
+
+    // Measures GPU time of named passes with asynchronous queries. A pass's time is
+    // read back Latency frames after it was recorded so the CPU never waits on the
+    // GPU. Passes can't nest: a pass begun inside another is counted as part of the
+    // outer one. Backends without timer queries report every pass as 0.
+    class GPUTimer {
+    public:
+        virtual ~GPUTimer() = default;
+
+        virtual bool IsSupported() const = 0;
+
+        virtual void BeginPass(const std::string& name) = 0;
+        virtual void EndPass() = 0;
+
+        // Closes the current frame and appends the passes that became available
+        virtual void EndFrame(std::vector<GPUTimerResult>& outResults) = 0;
+
+        static Scope<GPUTimer> Create(uint32_t latency = 3);
+    };
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+
+namespace Engine {
+
+    // Headless backend counters. When RendererAPI::API::Null is selected, draw calls,
+    // buffer uploads and texture binds are recorded here instead of reaching a GPU,
+    // so Renderer2D and Scene::OnRender can be measured on machines without one.
+    class NullRenderer {
+    public:
+        struct Counters {
+            uint32_t Frames = 0;
+            uint32_t Clears = 0;
+            uint32_t DrawCalls = 0;
+            uint64_t IndicesDrawn = 0;
+            uint64_t InstancesDrawn = 0;
+            uint32_t BufferUploads = 0;
+            uint64_t BufferUploadBytes = 0;
+            uint32_t TextureUploads = 0;
+            uint64_t TextureUploadBytes = 0;
+            uint32_t TextureBinds = 0;
+            uint32_t ShaderBinds = 0;
+            uint32_t UniformUploads = 0;
+        };
+        
+        static Counters& GetCounters();
+        static void ResetCounters();
+    };
+
+}
@@ -24,6 +24,9 @@ namespace Engine {
         const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
         const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
         
+        // World-space AABB of the visible area (covers the rotated view rectangle)
+        void GetViewBounds(glm::vec2& min, glm::vec2& max) const;
+        
     private:
         void RecalculateViewMatrix();
         
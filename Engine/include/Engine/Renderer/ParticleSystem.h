@@ -65,6 +65,12 @@ namespace Engine {
         std::vector<Particle> m_ParticlePool;
         uint32_t m_MaxParticles;
         uint32_t m_PoolIndex = 0;
+
+        // Per-frame render arrays, reused to avoid reallocating
+        std::vector<glm::vec3> m_RenderPositions;
+        std::vector<glm::vec2> m_RenderSizes;
+        std::vector<float> m_RenderRotations;
+        std::vector<glm::vec4> m_RenderColors;
     };
 
 } // namespace Engine
@@ -7,6 +7,8 @@ namespace Engine {
     class RenderCommand {
     public:
         static void Init() {
+            // Recreate in case the backend was switched after static initialization
+            s_RendererAPI = RendererAPI::Create();
             s_RendererAPI->Init();
         }
         
@@ -22,8 +24,36 @@ namespace Engine {
             s_RendererAPI->Clear();
         }
         
-        static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) {
-            s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+        static void SetBlend(bool enabled) {
+            s_RendererAPI->SetBlend(enabled);
+        }
+        
+        static void SetDepthWrite(bool enabled) {
+            s_RendererAPI->SetDepthWrite(enabled);
+        }
+        
+        static void SetDepthLessEqual(bool enabled) {
+            s_RendererAPI->SetDepthLessEqual(enabled);
+        }
+        
+        static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) {
+            s_RendererAPI->DrawIndexed(vertexArray, indexCount, baseVertex);
+        }
+        
+        static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) {
+            s_RendererAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount);
+        }
+        
+        static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) {
+            s_RendererAPI->DrawLines(vertexArray, vertexCount, firstVertex);
+        }
+        
+        static RendererAPI::StateChangeStats GetStateChangeStats() {
+            return s_RendererAPI->GetStateChangeStats();
+        }
+        
+        static void ResetStateChangeStats() {
+            s_RendererAPI->ResetStateChangeStats();
         }
         
     private:
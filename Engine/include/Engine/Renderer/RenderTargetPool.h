@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Framebuffer.h"
+#include <vector>
+
+namespace Engine {
+
+    // Hands out framebuffers for passes that need a temporary target, e.g. post
+    // processing. A target is free again once the caller drops its Ref, and a later
+    // request with the same attachments reuses it if it fits within the target's
+    // capacity. Targets nobody asked for in MaxIdleFrames frames are destroyed.
+    // Nothing in the engine owns a pool yet; whoever adds a temporary pass owns one
+    // and calls EndFrame once per frame.
+    class RenderTargetPool {
+    public:
+        static const uint32_t MaxIdleFrames = 60;
+
+        Ref<Framebuffer> Acquire(const FramebufferSpecification& spec);
+
+        // Once per frame, after the frame's passes released their targets
+        void EndFrame();
+
+        void Clear();
+
+        struct Stats {
+            uint32_t Targets = 0;       // Pooled framebuffers, free or in use
+            uint32_t Reused = 0;        // Acquire calls served from the pool since the last EndFrame
+            uint32_t Created = 0;       // Acquire calls that created a framebuffer since the last EndFrame
+        };
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        struct Entry {
+            Ref<Framebuffer> Target;
+            uint32_t IdleFrames = 0;
+        };
+
+        std::vector<Entry> m_Entries;
+        Stats m_Stats;
+    };
+
+}
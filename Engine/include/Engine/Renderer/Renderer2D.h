@@ -2,9 +2,53 @@
 
 #include "Engine/Renderer/OrthographicCamera.h"
 #include "Engine/Renderer/Texture.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include <functional>
 
 namespace Engine {
 
+    class StaticQuadBatch; // Retained GPU geometry, built by Renderer2D::BuildStaticBatch
+    class Font;
+    class TextureLayer;    // Image in a texture array layer, from TextureArrayAllocator
+
+    // Sub-buffer for one slice of Renderer2D::RecordParallel. Safe to use from a worker
+    // thread: it only writes its own storage and reads state captured in BeginScene.
+    // Rotations are in degrees.
+    class QuadRecorder {
+    public:
+        QuadRecorder();
+        ~QuadRecorder();
+        
+        void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+        void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture,
+                      float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture,
+                      float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+        void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                             const Ref<Texture2D>& texture, float tilingFactor = 1.0f,
+                             const glm::vec4& tintColor = glm::vec4(1.0f));
+        void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+                             const Ref<SubTexture2D>& subTexture, float tilingFactor = 1.0f,
+                             const glm::vec4& tintColor = glm::vec4(1.0f));
+        // Kept in submission order with the slice's quads
+        void DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color,
+                        float thickness = 1.0f, float fade = 0.005f);
+        
+        // Same test as Renderer2D::IsVisible, counted per recorder
+        bool IsVisible(const glm::vec2& center, const glm::vec2& halfExtent);
+        
+    private:
+        void Record(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                    const Ref<Texture2D>& texture, const glm::vec2* texCoords, float tilingFactor,
+                    const glm::vec4& tintColor);
+        
+        struct Storage;
+        Scope<Storage> m_Storage;
+        
+        friend class Renderer2D;
+    };
+
     class Renderer2D {
     public:
         static void Init();
@@ -14,6 +58,41 @@ namespace Engine {
         static void EndScene();
         static void Flush();
         
+        // Submission mode. Immediate writes vertices in call order; Sorted records quads
+        // with a 64-bit key (layer | depth | shader | texture), radix-sorts them at
+        // EndScene and only then expands them, so batches break per texture group
+        // rather than per call order. Layered sorts the same way but in two passes:
+        // opaque quads (alpha 1, untextured or RGB8 texture) front to back with
+        // blending off and depth writes on, so early-Z rejects what they hide, then
+        // everything else back to front without depth writes. Both passes test with
+        // GL_LEQUAL and move each layer LayerDepthBias nearer per layer step, so a
+        // higher layer wins against a lower one at the same z and transparent quads
+        // still draw over opaque ones of their own layer. Quads less than that
+        // apart in z may therefore swap across layers. Change modes outside
+        // BeginScene/EndScene.
+        enum class SubmissionMode {
+            Immediate = 0,
+            Sorted = 1,
+            Layered = 2
+        };
+        static void SetSubmissionMode(SubmissionMode mode);
+        static SubmissionMode GetSubmissionMode();
+        
+        // Layer applied to subsequent sorted submissions (higher draws later)
+        static void SetSortLayer(uint8_t layer);
+        // z offset per layer in Layered mode; a few hundred steps of a 24-bit depth buffer
+        static constexpr float LayerDepthBias = 1.0f / 65536.0f;
+        
+        // Conservative test against the camera bounds captured in BeginScene, for
+        // callers that want to skip work before submitting. Rejections are counted
+        // in Statistics::CulledCount.
+        static bool IsVisible(const glm::vec2& center, const glm::vec2& halfExtent);
+        
+        // Instanced path: one QuadInstance per quad, corners expanded in the vertex
+        // shader. Disabled by default; the per-vertex path remains as the fallback.
+        static void SetInstancingEnabled(bool enabled);
+        static bool IsInstancingEnabled();
+        
         // Primitives
         static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
         static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
@@ -21,6 +100,10 @@ namespace Engine {
                             float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
         static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, 
                             float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, 
+                            float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, 
+                            float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
         
         static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, 
                                    const glm::vec4& color);
@@ -32,25 +115,139 @@ namespace Engine {
         static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, 
                                    const Ref<Texture2D>& texture, float tilingFactor = 1.0f, 
                                    const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, 
+                                   const Ref<SubTexture2D>& subTexture, float tilingFactor = 1.0f, 
+                                   const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, 
+                                   const Ref<SubTexture2D>& subTexture, float tilingFactor = 1.0f, 
+                                   const glm::vec4& tintColor = glm::vec4(1.0f));
+        
+        // Texture array path. These quads go to their own batch, which binds one
+        // Texture2DArray and addresses images by layer, so it is not limited by texture
+        // slots and only breaks when the array changes. Instancing does not apply.
+        static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<TextureLayer>& layer, 
+                            float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<TextureLayer>& layer, 
+                            float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, 
+                                   const Ref<TextureLayer>& layer, float tilingFactor = 1.0f, 
+                                   const glm::vec4& tintColor = glm::vec4(1.0f));
+        static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, 
+                                   const Ref<TextureLayer>& layer, float tilingFactor = 1.0f, 
+                                   const glm::vec4& tintColor = glm::vec4(1.0f));
+        
+        // Untextured rotated quads from parallel arrays (rotation in degrees). Corners
+        // are computed for the whole array up front with the SIMD batch kernel.
+        static void DrawRotatedQuads(const glm::vec3* positions, const glm::vec2* sizes, const float* rotations,
+                                     const glm::vec4* colors, uint32_t count);
+        
+        // Parallel recording. generate(begin, end, recorder) is called for consecutive
+        // slices of [0, count) on JobSystem workers, each slice with its own recorder.
+        // Workers expand vertices (or, in Sorted and instanced mode, build commands and
+        // sort keys); the slices are then merged in order on the calling thread, which
+        // assigns texture slots and breaks batches. Slice boundaries don't depend on the
+        // thread count, so the output is byte-identical however many workers run.
+        using RecordFunction = std::function<void(uint32_t begin, uint32_t end, QuadRecorder& recorder)>;
+        static void RecordParallel(uint32_t count, const RecordFunction& generate);
+        
+        // Static geometry: quads baked once into retained vertex buffers, split wherever
+        // the texture slots or quad limit run out. Submission order is kept. A batch is
+        // drawn with a model transform, so geometry baked in local space can move
+        // without a rebuild. Parts outside the view are skipped. In Immediate mode a
+        // part flushes pending quads and draws at once; Sorted and Layered modes sort
+        // each part as one entry at its farthest z, so all of a part's quads draw together.
+        struct StaticQuad {
+            glm::vec3 Position;
+            glm::vec2 Size;
+            float Rotation = 0.0f; // Degrees
+            glm::vec4 Color = glm::vec4(1.0f);
+            Ref<Texture2D> Texture;
+            Ref<SubTexture2D> SubTexture; // Takes precedence over Texture
+            float TilingFactor = 1.0f;
+        };
+        static Ref<StaticQuadBatch> BuildStaticBatch(const std::vector<StaticQuad>& quads);
+        static void DrawStaticBatch(const Ref<StaticQuadBatch>& batch, const glm::mat4& transform = glm::mat4(1.0f));
         
-        // Circle (rendered as octagon approximation)
-        static void DrawCircle(const glm::vec2& position, float radius, const glm::vec4& color);
-        static void DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color);
+        // Circle, one quad per circle shaded by signed distance in its own batch.
+        // Thickness is a fraction of the radius (1 = filled, smaller = ring); fade
+        // softens the edges.
+        static void DrawCircle(const glm::vec2& position, float radius, const glm::vec4& color,
+                               float thickness = 1.0f, float fade = 0.005f);
+        static void DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color,
+                               float thickness = 1.0f, float fade = 0.005f);
+        
+        // Lines, one GL_LINES batch with a 16-byte vertex, for debug overlays such as
+        // physics shapes. Kept in submission order with the other primitives and never
+        // sorted; an overlay that must stay on top is drawn after EndScene in a scene
+        // of its own.
+        static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color);
+        // Rectangle outlines centred on position, rotation in degrees
+        static void DrawRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
+        static void DrawRotatedRect(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
+        // Closed outline through count points
+        static void DrawPolygon(const glm::vec3* points, uint32_t count, const glm::vec4& color);
+        
+        // Text, one textured quad per glyph in the regular quad batch. Position is the
+        // left end of the first baseline and size is the line height in world units.
+        // Layouts and their vertices are cached per font and string in layout space, so
+        // drawing a cached string only places, tints and copies them.
+        static void DrawString(const std::string& text, const Ref<Font>& font, const glm::vec2& position,
+                               float size, const glm::vec4& color = glm::vec4(1.0f));
+        static void DrawString(const std::string& text, const Ref<Font>& font, const glm::vec3& position,
+                               float size, const glm::vec4& color = glm::vec4(1.0f));
         
         // Stats
         struct Statistics {
             uint32_t DrawCalls = 0;
             uint32_t QuadCount = 0;
+            uint32_t CircleCount = 0;
+            uint32_t SortedQuadCount = 0;
+            uint32_t TextureSlotLookups = 0;
+            uint32_t SlotExhaustionBatchBreaks = 0; // Batches flushed because all texture slots were taken
+            uint32_t CulledCount = 0;               // Objects rejected by IsVisible
+            uint32_t StaticQuadCount = 0;           // Drawn from static batches, no per-frame vertex work
+            uint32_t TextLayouts = 0;               // Strings laid out because they were not cached
+            uint32_t TextureArraySwitches = 0;      // Texture array batches flushed because the array changed
+            uint32_t PrimitiveSwitches = 0;         // Batches flushed to keep quads, circles, array quads and lines in submission order
+            uint32_t LineCount = 0;
             
-            uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
-            uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
+            // Layered mode
+            uint32_t OpaqueQuadCount = 0;
+            uint32_t TransparentQuadCount = 0;
+            float Overdraw = 0.0f;                  // Submitted area over view area, summed per scene
+            
+            uint32_t GetTotalVertexCount() const { return (QuadCount + CircleCount) * 4; }
+            uint32_t GetTotalIndexCount() const { return (QuadCount + CircleCount) * 6; }
         };
         static void ResetStats();
         static Statistics GetStats();
         
     private:
+        // Quads, circles, texture array quads and lines are drawn by different shaders
+        // from separate buffers
+        enum class BatchPrimitive { Quad, Circle, ArrayQuad, Line };
+        
         static void StartBatch();
         static void NextBatch();
+        // Flushes the batch if another primitive is pending, so draws keep submission
+        // order rather than the fixed order Flush draws the batches in
+        static void SwitchPrimitive(BatchPrimitive primitive);
+        static float GetTextureSlot(const Ref<Texture2D>& texture);
+        // Shared by the Texture2D and SubTexture2D overloads; texCoords follow the corner order
+        static void DrawTexturedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                                     const Ref<Texture2D>& texture, const glm::vec2* texCoords,
+                                     float tilingFactor, const glm::vec4& tintColor);
+        static void SubmitQuadInstance(const glm::vec3& position, const glm::vec2& size, float radians,
+                                       const glm::vec4& color, const Ref<Texture2D>& texture, float tilingFactor,
+                                       const glm::vec4& texRect = { 0.0f, 0.0f, 1.0f, 1.0f });
+        static void FlushInstances();
+        static void FlushCircles();
+        static void FlushLines();
+        static void DrawArrayQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                                  const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor);
+        static void FlushArrayQuads();
+        static void SubmitSorted();
+        static void MergeRecorder(QuadRecorder& recorder);
     };
 
 }
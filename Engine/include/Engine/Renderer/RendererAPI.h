@@ -10,7 +10,14 @@ namespace Engine {
     class RendererAPI {
     public:
         enum class API {
-            None = 0, OpenGL = 1
+            None = 0, OpenGL = 1, Null = 2
+        };
+        
+        // GL state changes requested since the last reset: Issued reached the driver,
+        // Redundant were dropped because the state already had that value
+        struct StateChangeStats {
+            uint32_t Issued = 0;
+            uint32_t Redundant = 0;
         };
         
     public:
@@ -21,9 +28,22 @@ namespace Engine {
         virtual void SetClearColor(const glm::vec4& color) = 0;
         virtual void Clear() = 0;
         
-        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+        // Blending and depth writes are on by default; depth testing is always on
+        virtual void SetBlend(bool enabled) = 0;
+        virtual void SetDepthWrite(bool enabled) = 0;
+        // Lets fragments at equal depth pass too (GL_LEQUAL instead of GL_LESS); off by default
+        virtual void SetDepthLessEqual(bool enabled) = 0;
+        
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) = 0;
+        // Non-indexed GL_LINES, two vertices per segment
+        virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) = 0;
+        
+        virtual StateChangeStats GetStateChangeStats() const = 0;
+        virtual void ResetStateChangeStats() = 0;
         
         static API GetAPI() { return s_API; }
+        static void SetAPI(API api) { s_API = api; } // Must be called before RenderCommand::Init
         static Scope<RendererAPI> Create();
         
     private:
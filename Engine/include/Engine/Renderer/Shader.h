@@ -7,39 +7,25 @@ namespace Engine {
 
     class Shader {
     public:
-        Shader(const std::string& filepath);
-        Shader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
-        ~Shader();
+        virtual ~Shader() = default;
         
-        void Bind() const;
-        void Unbind() const;
+        virtual void Bind() const = 0;
+        virtual void Unbind() const = 0;
         
         // Set uniforms
-        void SetInt(const std::string& name, int value);
-        void SetIntArray(const std::string& name, int* values, uint32_t count);
-        void SetFloat(const std::string& name, float value);
-        void SetFloat2(const std::string& name, const glm::vec2& value);
-        void SetFloat3(const std::string& name, const glm::vec3& value);
-        void SetFloat4(const std::string& name, const glm::vec4& value);
-        void SetMat3(const std::string& name, const glm::mat3& value);
-        void SetMat4(const std::string& name, const glm::mat4& value);
+        virtual void SetInt(const std::string& name, int value) = 0;
+        virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
+        virtual void SetFloat(const std::string& name, float value) = 0;
+        virtual void SetFloat2(const std::string& name, const glm::vec2& value) = 0;
+        virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
+        virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
+        virtual void SetMat3(const std::string& name, const glm::mat3& value) = 0;
+        virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
         
-        const std::string& GetName() const { return m_Name; }
+        virtual const std::string& GetName() const = 0;
         
         static Ref<Shader> Create(const std::string& filepath);
         static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
-        
-    private:
-        std::string ReadFile(const std::string& filepath);
-        std::unordered_map<uint32_t, std::string> PreProcess(const std::string& source);
-        void Compile(const std::unordered_map<uint32_t, std::string>& shaderSources);
-        
-        int GetUniformLocation(const std::string& name);
-        
-    private:
-        uint32_t m_RendererID;
-        std::string m_Name;
-        std::unordered_map<std::string, int> m_UniformLocationCache;
     };
 
 }
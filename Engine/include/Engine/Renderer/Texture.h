@@ -4,6 +4,27 @@
 
 namespace Engine {
 
+    enum class ImageFormat {
+        None = 0,
+        RGB8,
+        RGBA8,
+        BC1,    // DXT1: 4 bits per pixel, 1-bit alpha
+        BC3,    // DXT5: 8 bits per pixel, smooth alpha
+        BC7     // 8 bits per pixel, higher quality than BC3
+    };
+
+    const char* ImageFormatToString(ImageFormat format);
+    // Bytes for a width x height image plus mipCount - 1 smaller levels
+    uint64_t GetImageFormatSize(ImageFormat format, uint32_t width, uint32_t height, uint32_t mipCount = 1);
+
+    // Opt-in sampling options for textures loaded from a file
+    struct TextureSpecification {
+        // Builds a mip chain for uncompressed images; compressed files bring their own
+        bool GenerateMips = false;
+        // Clamped to the driver's limit; 1 turns anisotropic filtering off
+        float MaxAnisotropy = 1.0f;
+    };
+
     class Texture {
     public:
         virtual ~Texture() = default;
@@ -11,11 +32,21 @@ namespace Engine {
         virtual uint32_t GetWidth() const = 0;
         virtual uint32_t GetHeight() const = 0;
         virtual uint32_t GetRendererID() const = 0;
+        virtual ImageFormat GetFormat() const = 0;
+        virtual uint32_t GetMipCount() const = 0;
+        // Storage of all mip levels in bytes
+        virtual uint64_t GetMemorySize() const = 0;
         
+        // Uncompressed textures only
         virtual void SetData(void* data, uint32_t size) = 0;
+        // Tightly packed pixels in the texture's format for the given rectangle
+        virtual void SetSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
         virtual void Bind(uint32_t slot = 0) const = 0;
         
         virtual bool IsLoaded() const = 0;
+        // False while an asynchronous load is in flight; the texture is a 1x1 placeholder
+        // until then. IsLoaded() tells whether the load succeeded once this is true.
+        virtual bool IsReady() const = 0;
         
         virtual bool operator==(const Texture& other) const = 0;
     };
@@ -23,7 +54,32 @@ namespace Engine {
     class Texture2D : public Texture {
     public:
         static Ref<Texture2D> Create(uint32_t width, uint32_t height);
-        static Ref<Texture2D> Create(const std::string& path);
+        // .dds files are uploaded as pre-compressed BC1/BC3/BC7 data, anything else is
+        // decoded with stb_image
+        static Ref<Texture2D> Create(const std::string& path, const TextureSpecification& specification = TextureSpecification());
+        // Returns a placeholder right away and loads through TextureUploadQueue
+        static Ref<Texture2D> CreateAsync(const std::string& path, const TextureSpecification& specification = TextureSpecification());
+    };
+
+    // Same-sized RGBA8 images stored as the layers of one array texture, so a single
+    // binding addresses all of them. Layers are handed out by TextureArrayAllocator.
+    class Texture2DArray {
+    public:
+        // Lowest GL_MAX_ARRAY_TEXTURE_LAYERS allowed by GL 3.3
+        static const uint32_t MaxLayers = 256;
+        
+        virtual ~Texture2DArray() = default;
+        
+        virtual uint32_t GetWidth() const = 0;
+        virtual uint32_t GetHeight() const = 0;
+        virtual uint32_t GetLayerCount() const = 0;
+        virtual uint32_t GetRendererID() const = 0;
+        
+        // Tightly packed RGBA8 pixels for a whole layer, bottom row first
+        virtual void SetLayerData(uint32_t layer, const void* data) = 0;
+        virtual void Bind(uint32_t slot = 0) const = 0;
+        
+        static Ref<Texture2DArray> Create(uint32_t width, uint32_t height, uint32_t layers);
     };
 
 }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    // One array texture plus its free layers, shared by the layers handed out from it
+    struct TextureArrayPool {
+        Ref<Texture2DArray> Array;
+        std::vector<uint32_t> FreeLayers;
+        uint32_t NextLayer = 0; // Layers from here on were never handed out
+    };
+
+    // An image stored in one layer of a texture array. The layer returns to its pool
+    // when the last reference goes away.
+    class TextureLayer {
+    public:
+        TextureLayer(const Ref<TextureArrayPool>& pool, uint32_t layer)
+            : m_Pool(pool), m_Layer(layer) {}
+        ~TextureLayer() { m_Pool->FreeLayers.push_back(m_Layer); }
+
+        const Ref<Texture2DArray>& GetArray() const { return m_Pool->Array; }
+        uint32_t GetLayer() const { return m_Layer; }
+
+    private:
+        Ref<TextureArrayPool> m_Pool;
+        uint32_t m_Layer;
+    };
+
+    // Groups same-sized images into texture array layers. Each size gets arrays of up
+    // to Texture2DArray::MaxLayers layers, fewer for large images so that one array
+    // stays within arrayBudget bytes; a new array opens when all of them are full.
+    class TextureArrayAllocator {
+    public:
+        TextureArrayAllocator(uint64_t arrayBudget = 16 * 1024 * 1024);
+
+        // Loads an image file into a free layer; returns nullptr if it fails to load
+        Ref<TextureLayer> Add(const std::string& path);
+        // Tightly packed RGBA8 pixels, bottom row first
+        Ref<TextureLayer> Add(const void* pixels, uint32_t width, uint32_t height);
+
+        uint32_t GetArrayCount() const;
+
+    private:
+        uint64_t m_ArrayBudget;
+        std::unordered_map<uint64_t, std::vector<Ref<TextureArrayPool>>> m_Pools; // Keyed by width << 32 | height
+    };
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include <vector>
+
+namespace Engine {
+
+    // Packs images into shared RGBA pages with a skyline bottom-left packer, so
+    // sprites loaded from separate files share a texture slot and batch together.
+    // A new page is opened whenever an image no longer fits the existing ones.
+    class TextureAtlas {
+    public:
+        TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 1);
+
+        // Loads an image file into the atlas; returns nullptr if it fails to load or is
+        // larger than a page
+        Ref<SubTexture2D> Add(const std::string& path);
+        // Tightly packed RGBA8 pixels, bottom row first
+        Ref<SubTexture2D> Add(const void* pixels, uint32_t width, uint32_t height);
+
+        const std::vector<Ref<Texture2D>>& GetPages() const { return m_PageTextures; }
+        uint32_t GetPageSize() const { return m_PageSize; }
+
+    private:
+        struct SkylineNode {
+            uint32_t X, Y, Width;
+        };
+
+        struct Page {
+            std::vector<SkylineNode> Skyline;
+        };
+
+        bool FindPosition(const Page& page, uint32_t width, uint32_t height,
+                          uint32_t& outX, uint32_t& outY, size_t& outNode) const;
+        void Insert(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+    private:
+        uint32_t m_PageSize;
+        uint32_t m_Padding;
+        std::vector<Page> m_Pages;
+        std::vector<Ref<Texture2D>> m_PageTextures;
+    };
+
+}
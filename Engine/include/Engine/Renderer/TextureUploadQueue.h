@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include <string>
+
+namespace Engine {
+
+    // Backend half of the upload queue: makes placeholder textures and moves decoded
+    // pixels into them on the render thread
+    class TextureUploader {
+    public:
+        virtual ~TextureUploader() = default;
+
+        // 1x1 transparent texture that reports IsReady() == false
+        virtual Ref<Texture2D> CreatePlaceholder(const std::string& path) = 0;
+
+        virtual void BeginFrame() = 0;
+        // Resizes the placeholder and uploads tightly packed RGB8 (3 channels) or RGBA8
+        // (4 channels) pixels, bottom row first, applies the specification's mips and
+        // sampling, then marks it ready. Returns false if no staging memory is free;
+        // retry in a later frame.
+        virtual bool Upload(const Ref<Texture2D>& texture, const void* pixels, uint32_t width, uint32_t height,
+                            uint32_t channels, const TextureSpecification& specification) = 0;
+        // Marks the placeholder ready but not loaded
+        virtual void Fail(const Ref<Texture2D>& texture) = 0;
+
+        static Scope<TextureUploader> Create(uint32_t stagingSize);
+    };
+
+    // Loads textures without stalling the render thread. Worker threads decode image
+    // files; Process() then uploads decoded images until the frame's byte budget is
+    // spent, so a level with many textures streams in over a few frames.
+    class TextureUploadQueue {
+    public:
+        static const uint32_t DefaultFrameBudget = 4 * 1024 * 1024;
+
+        static void Init(uint32_t workerCount = 2, uint32_t stagingSize = DefaultFrameBudget);
+        static void Shutdown();
+
+        // Returns a placeholder right away. Loads synchronously if the queue isn't running
+        // and for pre-compressed .dds files.
+        static Ref<Texture2D> Load(const std::string& path, const TextureSpecification& specification = TextureSpecification());
+
+        // Render thread, once per frame. One image larger than the budget still goes
+        // through on its own so it can't stall the queue.
+        static void Process(uint64_t byteBudget = DefaultFrameBudget);
+
+        // Textures handed out by Load() that are not ready yet
+        static uint32_t GetPendingCount();
+    };
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Renderer/Texture.h"
+#include "Engine/Renderer/SubTexture2D.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Engine {
+
+    class StaticQuadBatch;
+
+    // Dense grid of tile indices into a tileset sheet, split into ChunkSize x ChunkSize
+    // chunks. Each chunk keeps a baked quad batch that is rebuilt only after one of its
+    // tiles changes, and only chunks overlapping the camera are drawn.
+    class Tilemap {
+    public:
+        static const uint32_t ChunkSize = 32;
+        static const int32_t EmptyTile = -1;
+
+        Tilemap() = default;
+        Tilemap(uint32_t width, uint32_t height);
+
+        // Keeps the tiles that still fit, new cells start empty
+        void Resize(uint32_t width, uint32_t height);
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+
+        void SetTile(uint32_t x, uint32_t y, int32_t tile);
+        int32_t GetTile(uint32_t x, uint32_t y) const;
+
+        // Row-major, bottom row first, Width * Height entries
+        void SetTiles(const std::vector<int32_t>& tiles);
+        const std::vector<int32_t>& GetTiles() const { return m_Tiles; }
+
+        // Tile i is cell (i % columns, i / columns) of the sheet, counted from the bottom-left
+        void SetTileset(const Ref<Texture2D>& texture, const glm::vec2& cellSize);
+        const Ref<Texture2D>& GetTileset() const { return m_Tileset; }
+        const glm::vec2& GetCellSize() const { return m_CellSize; }
+
+        // World units per tile
+        void SetTileSize(float size);
+        float GetTileSize() const { return m_TileSize; }
+
+        // Tile (0, 0) is centred on the local origin, +x right and +y up. Chunks are baked
+        // in local space and drawn with transform, so moving, rotating or scaling the map
+        // doesn't rebuild them. Must be called between Renderer2D::BeginScene and EndScene.
+        void OnRender(const glm::mat4& transform);
+
+    private:
+        struct Chunk {
+            Ref<StaticQuadBatch> Batch;
+            bool Dirty = true;
+        };
+
+        void BuildChunk(uint32_t chunkX, uint32_t chunkY);
+        void InvalidateChunks();
+
+    private:
+        uint32_t m_Width = 0, m_Height = 0;
+        std::vector<int32_t> m_Tiles;
+
+        uint32_t m_ChunksX = 0, m_ChunksY = 0;
+        std::vector<Chunk> m_Chunks;
+
+        Ref<Texture2D> m_Tileset;
+        glm::vec2 m_CellSize = { 16.0f, 16.0f };
+        std::vector<Ref<SubTexture2D>> m_TileSubTextures;
+        float m_TileSize = 1.0f;
+    };
+
+}
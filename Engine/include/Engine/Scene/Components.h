@@ -5,6 +5,7 @@
 #include "Engine/Renderer/SubTexture2D.h"
 #include "Engine/Renderer/OrthographicCamera.h"
 #include "Engine/Renderer/ParticleSystem.h"
+#include "Engine/Renderer/Tilemap.h"
 #include "Engine/Physics/PhysicsComponents.h"
 #include "Engine/Animation/Animator.h"
 #include "Engine/Audio/AudioSource.h"
@@ -12,6 +13,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <sol/sol.hpp>
+#include <entt/entt.hpp>
 
 namespace Engine {
 
@@ -43,6 +45,36 @@ namespace Engine {
         }
     };
 
+    // Links an entity into the scene hierarchy. Children form a singly linked list
+    // through NextSibling. Only edit it through Scene::SetParent, which also keeps
+    // Depth (0 for roots) up to date.
+    struct RelationshipComponent {
+        entt::entity Parent = entt::null;
+        entt::entity FirstChild = entt::null;
+        entt::entity NextSibling = entt::null;
+        uint32_t Depth = 0;
+        
+        RelationshipComponent() = default;
+    };
+
+    // Cached world transform, added by the scene alongside every TransformComponent.
+    // Scene rebuilds it only when the local transform or an ancestor's world
+    // transform has changed. Transform is exact. Position, Rotation and Scale are
+    // the 2D decomposition that sprites and physics read, and ignore shear from
+    // rotating a child under a non-uniformly scaled parent.
+    struct WorldTransformComponent {
+        glm::mat4 Transform = glm::mat4(1.0f);
+        glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 Rotation = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+        
+        TransformComponent Local;  // Local transform the cache was built from
+        bool Dirty = true;         // Rebuild on the next pass even if Local matches
+        bool Changed = false;      // Rebuilt by the latest pass
+        
+        WorldTransformComponent() = default;
+    };
+
     struct SpriteRendererComponent {
         glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
         Ref<Texture2D> Texture;
@@ -54,6 +86,29 @@ namespace Engine {
             : Color(color) {}
     };
 
+    // Level geometry that never moves. Scene bakes these sprites into a retained batch
+    // instead of regenerating their quads every frame (always as quads, even with a
+    // circle collider). Transform changes, including an ancestor's, are picked up by
+    // the world transform pass. Sprite changes made through registry patch/replace are
+    // picked up automatically; after editing one through a plain reference, call
+    // Scene::InvalidateStaticBatch().
+    struct StaticSpriteComponent {
+        bool Visible = true; // Hidden static sprites are left out of the batch
+        
+        StaticSpriteComponent() = default;
+    };
+
+    // Grid of tiles drawn from one tileset sheet, anchored at the entity's position
+    // (only Position is used, the map is not rotated or scaled).
+    struct TilemapComponent {
+        Tilemap Tilemap;
+        std::string TilesetPath; // Reloaded by SceneSerializer
+        
+        TilemapComponent() = default;
+        TilemapComponent(uint32_t width, uint32_t height)
+            : Tilemap(width, height) {}
+    };
+
     struct AnimationComponent {
         Animator Animator;
         std::string StartAnimation;
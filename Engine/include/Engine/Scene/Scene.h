@@ -10,6 +10,9 @@ namespace Engine {
 
     class Entity;
     class ContactListener;
+    class StaticQuadBatch;
+    class SystemScheduler;
+    struct WorldTransformComponent;
 
     class Scene {
     public:
@@ -37,6 +40,19 @@ namespace Engine {
         void ClearWorldBounds() { m_UseWorldBounds = false; }
         bool IsEntityInBounds(Entity entity) const;
         
+        // Rebuild the static sprite batch before the next render
+        void InvalidateStaticBatch() { m_StaticBatchDirty = true; }
+        
+        // Hierarchy. The child keeps its local transform, which is from then on
+        // relative to the parent; pass a null entity to make it a root again.
+        // Destroying an entity destroys its children with it.
+        void SetParent(Entity child, Entity parent);
+        Entity GetParent(Entity entity);
+        
+        // Rebuilds cached world transforms whose local transform or ancestor changed,
+        // parents before children. Runs during OnUpdate and OnRender.
+        void UpdateWorldTransforms();
+        
         // Allow editor access to registry
         friend class SceneHierarchyPanel;
         friend class SceneSerializer;
@@ -45,11 +61,30 @@ namespace Engine {
         template<typename T>
         void OnComponentAdded(Entity entity, T& component);
         
+        void RegisterSystems();
+        void UpdateScripts(TimeStep ts);
+        void UpdateAnimations(TimeStep ts);
+        void UpdateParticles(TimeStep ts);
+        void UpdateLegacyPhysics(TimeStep ts);
+        void ClampToWorldBounds();
+        
         void OnPhysics2DStart();
         void OnPhysics2DStop();
         void OnPhysics2DUpdate(TimeStep ts);
         void CreatePhysicsBody(Entity entity); // Helper to create physics body dynamically
         
+        void OnStaticSpriteChanged(entt::registry& registry, entt::entity entity);
+        void RebuildStaticBatch();
+        
+        void OnTransformConstructed(entt::registry& registry, entt::entity entity);
+        void OnTransformDestroyed(entt::registry& registry, entt::entity entity);
+        void UnlinkFromParent(entt::entity entity);
+        void UpdateHierarchyDepth(entt::entity entity, uint32_t depth);
+        // World transform of an entity whose cache may be stale, built from its
+        // parent's cached world transform
+        WorldTransformComponent ComputeWorldTransform(entt::entity entity);
+        void SyncAudio();
+        
     private:
         entt::registry m_Registry;
         std::string m_Name;
@@ -62,6 +97,20 @@ namespace Engine {
         // Particles
         Scope<ParticleSystem> m_ParticleSystem;
         
+        // OnUpdate systems
+        Scope<SystemScheduler> m_Systems;
+        
+        // Static sprites
+        Ref<StaticQuadBatch> m_StaticBatch;
+        bool m_StaticBatchDirty = true;
+        
+        // Sprites to render this frame, sliced across job workers
+        std::vector<entt::entity> m_RenderEntities;
+        
+        // Transformed entities ordered by hierarchy depth
+        std::vector<entt::entity> m_TransformOrder;
+        bool m_TransformOrderDirty = true;
+        
         // World bounds
         bool m_UseWorldBounds = false;
         glm::vec2 m_WorldBoundsMin = { -100.0f, -100.0f };
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Engine/Core/Base.h"
+#include "Engine/Core/TimeStep.h"
+#include <entt/entt.hpp>
+#include <functional>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+namespace Engine {
+
+    // Runs per-frame systems on the job system, in parallel where their data doesn't
+    // overlap. Each system declares the component types it reads and writes, and any
+    // other shared state as a resource type. Two systems conflict when either writes
+    // something the other uses. A system runs after every conflicting system added
+    // before it and alongside the rest.
+    //
+    // Systems that run in parallel must not create or destroy entities, add or
+    // remove components, or open profiler scopes. Mark such systems Exclusive: they
+    // run alone on the calling thread. Every system is timed, and the timings go to
+    // the Profiler when profiling is enabled.
+    class SystemScheduler {
+    public:
+        using SystemFunction = std::function<void(TimeStep)>;
+
+        struct System {
+            std::string Name;
+            SystemFunction Function;
+            std::vector<std::type_index> Reads;
+            std::vector<std::type_index> Writes;
+            bool Exclusive = false;
+            float Duration = 0.0f; // Milliseconds, last run
+        };
+
+        class SystemBuilder {
+        public:
+            template<typename... Components>
+            SystemBuilder& Reads() {
+                (m_Scheduler.AddComponentAccess<Components>(m_Index, false), ...);
+                return *this;
+            }
+
+            template<typename... Components>
+            SystemBuilder& Writes() {
+                (m_Scheduler.AddComponentAccess<Components>(m_Index, true), ...);
+                return *this;
+            }
+
+            template<typename... Resources>
+            SystemBuilder& ReadsResource() {
+                (m_Scheduler.AddAccess(m_Index, typeid(Resources), false), ...);
+                return *this;
+            }
+
+            template<typename... Resources>
+            SystemBuilder& WritesResource() {
+                (m_Scheduler.AddAccess(m_Index, typeid(Resources), true), ...);
+                return *this;
+            }
+
+            SystemBuilder& Exclusive();
+
+        private:
+            SystemBuilder(SystemScheduler& scheduler, uint32_t index)
+                : m_Scheduler(scheduler), m_Index(index) {}
+
+            SystemScheduler& m_Scheduler;
+            uint32_t m_Index;
+
+            friend class SystemScheduler;
+        };
+
+        SystemScheduler(entt::registry& registry);
+
+        // Declare the system's data on the returned builder straight away
+        SystemBuilder AddSystem(const std::string& name, const SystemFunction& function);
+
+        // Runs every system once. Call from the main thread.
+        void Run(TimeStep ts);
+
+        const std::vector<System>& GetSystems() const { return m_Systems; }
+        uint32_t GetStageCount();
+
+    private:
+        template<typename Component>
+        void AddComponentAccess(uint32_t index, bool write) {
+            // Create the storage now so no worker adds it to the registry mid-frame
+            (void)m_Registry.view<Component>();
+            AddAccess(index, typeid(Component), write);
+        }
+
+        void AddAccess(uint32_t index, std::type_index type, bool write);
+        bool Conflicts(const System& a, const System& b) const;
+        void BuildStages();
+        void RunSystem(System& system, TimeStep ts);
+
+    private:
+        entt::registry& m_Registry;
+        std::vector<System> m_Systems;
+        std::vector<std::vector<uint32_t>> m_Stages;
+        bool m_StagesDirty = true;
+    };
+
+} // namespace Engine
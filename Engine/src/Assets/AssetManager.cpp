@@ -4,15 +4,17 @@
 namespace Engine {
 
     std::unordered_map<std::string, Ref<Texture2D>> AssetManager::s_Textures;
+    std::unordered_map<std::string, Ref<SubTexture2D>> AssetManager::s_Sprites;
+    Scope<TextureAtlas> AssetManager::s_SpriteAtlas;
     std::unordered_map<std::string, Ref<Shader>> AssetManager::s_Shaders;
 
-    Ref<Texture2D> AssetManager::LoadTexture(const std::string& name, const std::string& path) {
+    Ref<Texture2D> AssetManager::LoadTexture(const std::string& name, const std::string& path, const TextureSpecification& specification) {
         if (s_Textures.find(name) != s_Textures.end()) {
             GE_CORE_WARN("Texture '{0}' already loaded, returning cached version", name);
             return s_Textures[name];
         }
         
-        auto texture = Texture2D::Create(path);
+        auto texture = Texture2D::Create(path, specification);
         if (texture->IsLoaded()) {
             s_Textures[name] = texture;
             GE_CORE_INFO("Loaded texture '{0}' from '{1}'", name, path);
@@ -23,6 +25,18 @@ namespace Engine {
         return nullptr;
     }
 
+    Ref<Texture2D> AssetManager::LoadTextureAsync(const std::string& name, const std::string& path, const TextureSpecification& specification) {
+        if (s_Textures.find(name) != s_Textures.end()) {
+            GE_CORE_WARN("Texture '{0}' already loaded, returning cached version", name);
+            return s_Textures[name];
+        }
+        
+        // Load failures only show up later, through IsLoaded() once the texture is ready
+        auto texture = Texture2D::CreateAsync(path, specification);
+        s_Textures[name] = texture;
+        return texture;
+    }
+
     Ref<Texture2D> AssetManager::GetTexture(const std::string& name) {
         if (s_Textures.find(name) == s_Textures.end()) {
             GE_CORE_ERROR("Texture '{0}' not found in asset manager", name);
@@ -42,6 +56,39 @@ namespace Engine {
         }
     }
 
+    Ref<SubTexture2D> AssetManager::LoadSprite(const std::string& name, const std::string& path) {
+        if (s_Sprites.find(name) != s_Sprites.end()) {
+            GE_CORE_WARN("Sprite '{0}' already loaded, returning cached version", name);
+            return s_Sprites[name];
+        }
+        
+        // Created on first use, once the renderer backend exists
+        if (!s_SpriteAtlas)
+            s_SpriteAtlas = CreateScope<TextureAtlas>();
+        
+        auto sprite = s_SpriteAtlas->Add(path);
+        if (sprite) {
+            s_Sprites[name] = sprite;
+            GE_CORE_INFO("Loaded sprite '{0}' from '{1}' into the sprite atlas", name, path);
+            return sprite;
+        }
+        
+        GE_CORE_ERROR("Failed to load sprite '{0}' from '{1}'", name, path);
+        return nullptr;
+    }
+
+    Ref<SubTexture2D> AssetManager::GetSprite(const std::string& name) {
+        if (s_Sprites.find(name) == s_Sprites.end()) {
+            GE_CORE_ERROR("Sprite '{0}' not found in asset manager", name);
+            return nullptr;
+        }
+        return s_Sprites[name];
+    }
+
+    bool AssetManager::HasSprite(const std::string& name) {
+        return s_Sprites.find(name) != s_Sprites.end();
+    }
+
     Ref<Shader> AssetManager::LoadShader(const std::string& name, const std::string& path) {
         if (s_Shaders.find(name) != s_Shaders.end()) {
             GE_CORE_WARN("Shader '{0}' already loaded, returning cached version", name);
@@ -75,6 +122,8 @@ namespace Engine {
 
     void AssetManager::Clear() {
         s_Textures.clear();
+        s_Sprites.clear();
+        s_SpriteAtlas.reset();
         s_Shaders.clear();
         GE_CORE_INFO("Cleared all assets from AssetManager");
     }
@@ -83,10 +132,20 @@ namespace Engine {
         Stats stats;
         stats.TexturesLoaded = (uint32_t)s_Textures.size();
         stats.ShadersLoaded = (uint32_t)s_Shaders.size();
+        stats.SpritesLoaded = (uint32_t)s_Sprites.size();
+        stats.AtlasPages = s_SpriteAtlas ? (uint32_t)s_SpriteAtlas->GetPages().size() : 0;
+        
+        auto addTexture = [&stats](const Ref<Texture2D>& texture) {
+            uint64_t size = texture->GetMemorySize();
+            stats.MemoryUsage += size;
+            stats.MemoryByFormat[texture->GetFormat()] += size;
+        };
         
-        // Estimate memory usage
-        for (const auto& [name, texture] : s_Textures) {
-            stats.EstimatedMemoryUsage += texture->GetWidth() * texture->GetHeight() * 4; // RGBA
+        for (const auto& [name, texture] : s_Textures)
+            addTexture(texture);
+        if (s_SpriteAtlas) {
+            for (const Ref<Texture2D>& page : s_SpriteAtlas->GetPages())
+                addTexture(page);
         }
         
         return stats;
@@ -1,26 +1,32 @@
 #include "Engine/Core/Application.h"
 #include "Engine/Core/Logger.h"
 #include "Engine/Core/Input.h"
+#include "Engine/Core/JobSystem.h"
 #include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/TextureUploadQueue.h"
 #include "Engine/Audio/AudioEngine.h"
 #include "Engine/Scripting/ScriptEngine.h"
 #include "Engine/ImGui/ImGuiLayer.h"
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
+#include "Engine/Debug/Profiler.h"
 
 namespace Engine {
 
     Application* Application::s_Instance = nullptr;
 
-    Application::Application(const std::string& name) {
+    Application::Application(const std::string& name, RendererAPI::API api) {
         GE_ASSERT(!s_Instance, "Application already exists!");
         s_Instance = this;
         
         // Initialize logger
         Logger::Init();
         
+        // Worker threads for parallel loops such as sprite recording
+        JobSystem::Init();
+        
+        // Select the rendering backend before anything creates GPU resources
+        RendererAPI::SetAPI(api);
+        
         // Create window
         WindowProps props;
         props.Title = name;
@@ -30,6 +36,7 @@ namespace Engine {
         // Initialize renderer
         RenderCommand::Init();
         Renderer2D::Init();
+        TextureUploadQueue::Init();
         
         // Initialize audio
         AudioEngine::Init();
@@ -47,9 +54,12 @@ namespace Engine {
             delete layer;
         }
         
+        Profiler::Get().Shutdown();
+        TextureUploadQueue::Shutdown();
         Renderer2D::Shutdown();
         AudioEngine::Shutdown();
         ScriptEngine::Shutdown();
+        JobSystem::Shutdown();
         GE_CORE_INFO("Application shutting down");
     }
 
@@ -81,7 +91,7 @@ namespace Engine {
         
         while (m_Running) {
             // Calculate delta time
-            float time = (float)glfwGetTime();
+            float time = m_Window->GetTime();
             TimeStep timestep = time - m_LastFrameTime;
             m_LastFrameTime = time;
             
@@ -89,6 +99,10 @@ namespace Engine {
             if (!m_Minimized) {
                 // Reset renderer stats for this frame
                 Renderer2D::ResetStats();
+                RenderCommand::ResetStateChangeStats();
+                
+                // Finish textures decoded since last frame, within the upload budget
+                TextureUploadQueue::Process();
                 
                 // Clear screen
                 RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
@@ -110,6 +124,7 @@ namespace Engine {
                 }
                 
                 if (imguiLayer) {
+                    GE_PROFILE_GPU_SCOPE("ImGui");
                     imguiLayer->Begin();
                     
                     // Render ImGui for all layers
@@ -119,6 +134,8 @@ namespace Engine {
                     
                     imguiLayer->End();
                 }
+                
+                Profiler::Get().EndFrame();
             }
             
             // Update window
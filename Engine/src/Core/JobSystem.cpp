@@ -0,0 +1,220 @@
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Logger.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Engine {
+
+    struct QueuedJob {
+        JobSystem::Job Function;
+        // Batches of a parallel loop point at the caller's function instead of
+        // wrapping it in a new std::function
+        const JobSystem::RangeFunction* Range = nullptr;
+        uint32_t Begin = 0, End = 0;
+        JobCounter* Counter = nullptr;
+    };
+
+    struct JobQueue {
+        std::mutex Mutex;
+        std::deque<QueuedJob> Jobs;
+    };
+
+    struct JobSystemData {
+        std::vector<std::thread> Workers;
+        std::vector<Scope<JobQueue>> Queues; // [0] main thread, [i + 1] worker i
+
+        // Idle workers sleep until something is queued
+        std::mutex SleepMutex;
+        std::condition_variable WorkAvailable;
+        std::atomic<uint32_t> QueuedJobs{ 0 };
+        bool Stopping = false;
+    };
+
+    static JobSystemData s_Data;
+    static thread_local uint32_t s_QueueIndex = 0;
+
+    static void Push(std::vector<QueuedJob>& jobs) {
+        JobQueue& queue = *s_Data.Queues[s_QueueIndex];
+        {
+            // Counted before the jobs become visible, so a thief's decrement can
+            // never run ahead of the increment and wrap the count around
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            s_Data.QueuedJobs += (uint32_t)jobs.size();
+            for (QueuedJob& job : jobs)
+                queue.Jobs.push_back(std::move(job));
+        }
+
+        // Taking the lock orders this with a worker that is about to sleep
+        { std::lock_guard<std::mutex> lock(s_Data.SleepMutex); }
+        if (jobs.size() == 1)
+            s_Data.WorkAvailable.notify_one();
+        else
+            s_Data.WorkAvailable.notify_all();
+    }
+
+    static bool TryPop(QueuedJob& job) {
+        const uint32_t queueCount = (uint32_t)s_Data.Queues.size();
+
+        // Newest job from our own deque, it is most likely still in cache
+        {
+            JobQueue& own = *s_Data.Queues[s_QueueIndex];
+            std::lock_guard<std::mutex> lock(own.Mutex);
+            if (!own.Jobs.empty()) {
+                job = std::move(own.Jobs.back());
+                own.Jobs.pop_back();
+                s_Data.QueuedJobs--;
+                return true;
+            }
+        }
+
+        // Otherwise the oldest job of another thread
+        for (uint32_t i = 1; i < queueCount; i++) {
+            JobQueue& victim = *s_Data.Queues[(s_QueueIndex + i) % queueCount];
+            std::lock_guard<std::mutex> lock(victim.Mutex);
+            if (!victim.Jobs.empty()) {
+                job = std::move(victim.Jobs.front());
+                victim.Jobs.pop_front();
+                s_Data.QueuedJobs--;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::Execute(QueuedJob& job) {
+        if (job.Range)
+            (*job.Range)(job.Begin, job.End);
+        else
+            job.Function();
+
+        // A waiter may destroy the counter as soon as it reaches zero, so read the
+        // parent first
+        for (JobCounter* counter = job.Counter; counter; ) {
+            JobCounter* parent = counter->m_Parent;
+            counter->m_Pending.fetch_sub(1, std::memory_order_release);
+            counter = parent;
+        }
+    }
+
+    void JobSystem::WorkerLoop(uint32_t queueIndex) {
+        s_QueueIndex = queueIndex;
+
+        QueuedJob job;
+        while (true) {
+            if (TryPop(job)) {
+                Execute(job);
+                job = QueuedJob();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(s_Data.SleepMutex);
+            s_Data.WorkAvailable.wait(lock, [] { return s_Data.Stopping || s_Data.QueuedJobs > 0; });
+            if (s_Data.Stopping)
+                return;
+        }
+    }
+
+    void JobSystem::Init(uint32_t workerCount) {
+        if (workerCount == 0) {
+            uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+
+        s_Data.Stopping = false;
+        s_QueueIndex = 0;
+        for (uint32_t i = 0; i < workerCount + 1; i++)
+            s_Data.Queues.push_back(CreateScope<JobQueue>());
+        for (uint32_t i = 0; i < workerCount; i++)
+            s_Data.Workers.emplace_back(WorkerLoop, i + 1);
+
+        GE_CORE_INFO("Job system started with {0} worker threads", workerCount);
+    }
+
+    void JobSystem::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(s_Data.SleepMutex);
+            s_Data.Stopping = true;
+        }
+        s_Data.WorkAvailable.notify_all();
+
+        for (std::thread& worker : s_Data.Workers)
+            worker.join();
+        s_Data.Workers.clear();
+        s_Data.Queues.clear();
+        s_Data.QueuedJobs = 0;
+    }
+
+    uint32_t JobSystem::GetWorkerCount() {
+        return (uint32_t)s_Data.Workers.size();
+    }
+
+    void JobSystem::Run(const Job& job, JobCounter* counter) {
+        if (s_Data.Workers.empty()) {
+            job();
+            return;
+        }
+
+        for (JobCounter* c = counter; c; c = c->m_Parent)
+            c->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+        std::vector<QueuedJob> jobs(1);
+        jobs[0].Function = job;
+        jobs[0].Counter = counter;
+        Push(jobs);
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        QueuedJob job;
+        while (!counter.IsDone()) {
+            if (TryPop(job)) {
+                Execute(job);
+                job = QueuedJob();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::ParallelForRange(uint32_t count, uint32_t batchSize, const RangeFunction& func) {
+        if (count == 0)
+            return;
+
+        if (batchSize == 0) {
+            const uint32_t threads = (uint32_t)s_Data.Workers.size() + 1;
+            batchSize = std::max(count / (threads * 4), 1u);
+        }
+
+        if (s_Data.Workers.empty() || count <= batchSize) {
+            func(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        const uint32_t batchCount = (count + batchSize - 1) / batchSize;
+        counter.m_Pending.store(batchCount, std::memory_order_relaxed);
+
+        std::vector<QueuedJob> jobs(batchCount);
+        for (uint32_t i = 0; i < batchCount; i++) {
+            jobs[i].Range = &func;
+            jobs[i].Begin = i * batchSize;
+            jobs[i].End = std::min(count, (i + 1) * batchSize);
+            jobs[i].Counter = &counter;
+        }
+
+        Push(jobs);
+        Wait(counter);
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func) {
+        ParallelForRange(count, 0, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++)
+                func(i);
+        });
+    }
+
+} // namespace Engine
@@ -0,0 +1,20 @@
+#include "Engine/Core/Window.h"
+#include "Engine/Core/Logger.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "../Platform/OpenGL/GLFWWindow.h"
+#include "../Platform/Null/NullWindow.h"
+
+namespace Engine {
+
+    Scope<Window> Window::Create(const WindowProps& props) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateScope<GLFWWindow>(props);
+            case RendererAPI::API::Null:    return CreateScope<NullWindow>(props);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
@@ -49,5 +49,54 @@ namespace Engine {
         m_Results.push_back(result);
     }
 
-} // namespace Engine
+    void Profiler::AddResult(const std::string& name, float duration) {
+        ProfileResult result;
+        result.Name = name;
+        result.Duration = duration;
+        result.Depth = m_CurrentDepth;
+
+        m_Results.push_back(result);
+    }
 
+    void Profiler::BeginGPUPass(const std::string& name) {
+        if (!m_GPUTimer)
+            m_GPUTimer = GPUTimer::Create();
+        m_GPUTimer->BeginPass(name);
+    }
+
+    void Profiler::EndGPUPass() {
+        if (m_GPUTimer)
+            m_GPUTimer->EndPass();
+    }
+
+    void Profiler::EndFrame() {
+        if (!m_GPUTimer)
+            return;
+
+        m_GPUResults.clear();
+        m_GPUTimer->EndFrame(m_GPUResults);
+
+        // Keep one entry per pass, updated in place
+        for (const GPUTimerResult& gpuResult : m_GPUResults) {
+            auto it = std::find_if(m_Results.begin(), m_Results.end(), [&](const ProfileResult& result) {
+                return result.GPU && result.Name == gpuResult.Name;
+            });
+
+            if (it != m_Results.end()) {
+                it->Duration = gpuResult.Duration;
+            } else {
+                ProfileResult result;
+                result.Name = gpuResult.Name;
+                result.Duration = gpuResult.Duration;
+                result.Depth = 0;
+                result.GPU = true;
+                m_Results.push_back(result);
+            }
+        }
+    }
+
+    void Profiler::Shutdown() {
+        m_GPUTimer.reset();
+    }
+
+} // namespace Engine
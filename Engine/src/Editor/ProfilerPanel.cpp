@@ -84,7 +84,10 @@ namespace Engine {
                     }
                     
                     ImGui::PushStyleColor(ImGuiCol_Text, color);
-                    ImGui::Text("%s: %.3f ms", result.Name.c_str(), result.Duration);
+                    if (result.GPU)
+                        ImGui::Text("[GPU] %s: %.3f ms", result.Name.c_str(), result.Duration);
+                    else
+                        ImGui::Text("%s: %.3f ms", result.Name.c_str(), result.Duration);
                     ImGui::PopStyleColor();
                     
                     // Unindent
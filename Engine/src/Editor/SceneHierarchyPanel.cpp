@@ -24,8 +24,13 @@ namespace Engine {
 
         if (m_Context) {
             try {
+                // Roots here, children are drawn under their parent's node
                 auto view = m_Context->m_Registry.view<TagComponent>();
                 for (auto entityID : view) {
+                    auto* relationship = m_Context->m_Registry.try_get<RelationshipComponent>(entityID);
+                    if (relationship && relationship->Parent != entt::null)
+                        continue;
+                    
                     Entity entity{ entityID, m_Context.get() };
                     DrawEntityNode(entity);
                 }
@@ -64,9 +69,13 @@ namespace Engine {
 
     void SceneHierarchyPanel::DrawEntityNode(Entity entity) {
         auto& tag = entity.GetComponent<TagComponent>().Tag;
+        auto* relationship = m_Context->m_Registry.try_get<RelationshipComponent>(entity);
+        entt::entity firstChild = relationship ? relationship->FirstChild : entt::null;
 
         ImGuiTreeNodeFlags flags = ((m_SelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
         flags |= ImGuiTreeNodeFlags_SpanAvailWidth;
+        if (firstChild == entt::null)
+            flags |= ImGuiTreeNodeFlags_Leaf;
         bool opened = ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, "%s", tag.c_str());
         
         if (ImGui::IsItemClicked()) {
@@ -75,6 +84,12 @@ namespace Engine {
 
         bool entityDeleted = false;
         if (ImGui::BeginPopupContextItem()) {
+            if (ImGui::MenuItem("Create Child Entity"))
+                m_Context->SetParent(m_Context->CreateEntity("Empty Entity"), entity);
+
+            if (m_Context->GetParent(entity) && ImGui::MenuItem("Detach From Parent"))
+                m_Context->SetParent(entity, {});
+
             if (ImGui::MenuItem("Delete Entity"))
                 entityDeleted = true;
 
@@ -82,6 +97,12 @@ namespace Engine {
         }
 
         if (opened) {
+            // Read the next sibling first, deleting a child unlinks it
+            for (entt::entity child = firstChild; child != entt::null; ) {
+                entt::entity next = m_Context->m_Registry.get<RelationshipComponent>(child).NextSibling;
+                DrawEntityNode({ child, m_Context.get() });
+                child = next;
+            }
             ImGui::TreePop();
         }
 
@@ -218,6 +239,18 @@ namespace Engine {
                 ImGui::CloseCurrentPopup();
             }
 
+            if (ImGui::MenuItem("Static Sprite")) {
+                if (!m_SelectionContext.HasComponent<StaticSpriteComponent>())
+                    m_SelectionContext.AddComponent<StaticSpriteComponent>();
+                ImGui::CloseCurrentPopup();
+            }
+
+            if (ImGui::MenuItem("Tilemap")) {
+                if (!m_SelectionContext.HasComponent<TilemapComponent>())
+                    m_SelectionContext.AddComponent<TilemapComponent>(32u, 32u);
+                ImGui::CloseCurrentPopup();
+            }
+
             if (ImGui::MenuItem("Rigidbody 2D")) {
                 if (!m_SelectionContext.HasComponent<Rigidbody2DComponent>())
                     m_SelectionContext.AddComponent<Rigidbody2DComponent>();
@@ -265,6 +298,13 @@ namespace Engine {
 
         ImGui::PopItemWidth();
 
+        // Static sprites are baked, so sprite edits below have to invalidate the batch.
+        // Transform edits are caught by the scene's world transform pass.
+        const bool isStatic = entity.HasComponent<StaticSpriteComponent>();
+        SpriteRendererComponent spriteBefore;
+        if (isStatic && entity.HasComponent<SpriteRendererComponent>())
+            spriteBefore = entity.GetComponent<SpriteRendererComponent>();
+
         DrawComponent<TransformComponent>("Transform", entity, [](auto& component) {
             DrawVec3Control("Position", component.Position);
             glm::vec3 rotation = glm::degrees(component.Rotation);
@@ -297,6 +337,40 @@ namespace Engine {
             ImGui::ColorEdit4("Color", glm::value_ptr(component.Color));
         });
 
+        bool staticVisibilityChanged = false;
+        DrawComponent<StaticSpriteComponent>("Static Sprite", entity, [&](auto& component) {
+            staticVisibilityChanged = ImGui::Checkbox("Visible", &component.Visible);
+        });
+
+        if (isStatic && entity.HasComponent<SpriteRendererComponent>()) {
+            const auto& sprite = entity.GetComponent<SpriteRendererComponent>();
+            if (staticVisibilityChanged || sprite.Color != spriteBefore.Color || sprite.TilingFactor != spriteBefore.TilingFactor)
+                m_Context->InvalidateStaticBatch();
+        }
+
+        DrawComponent<TilemapComponent>("Tilemap", entity, [](auto& component) {
+            Tilemap& map = component.Tilemap;
+            int size[2] = { (int)map.GetWidth(), (int)map.GetHeight() };
+            if (ImGui::DragInt2("Size", size, 1.0f, 1, 4096) && size[0] > 0 && size[1] > 0)
+                map.Resize((uint32_t)size[0], (uint32_t)size[1]);
+
+            float tileSize = map.GetTileSize();
+            if (ImGui::DragFloat("Tile Size", &tileSize, 0.01f, 0.01f, 100.0f))
+                map.SetTileSize(tileSize);
+
+            char buffer[256];
+            memset(buffer, 0, sizeof(buffer));
+            strcpy(buffer, component.TilesetPath.c_str());
+            if (ImGui::InputText("Tileset Path", buffer, sizeof(buffer)))
+                component.TilesetPath = std::string(buffer);
+
+            glm::vec2 cellSize = map.GetCellSize();
+            if (ImGui::DragFloat2("Cell Size", glm::value_ptr(cellSize), 1.0f, 1.0f, 1024.0f))
+                map.SetTileset(map.GetTileset(), cellSize);
+            if (ImGui::Button("Load Tileset") && !component.TilesetPath.empty())
+                map.SetTileset(Texture2D::Create(component.TilesetPath), cellSize);
+        });
+
         DrawComponent<Rigidbody2DComponent>("Rigidbody 2D", entity, [](auto& component) {
             const char* bodyTypeStrings[] = { "Static", "Dynamic", "Kinematic" };
             const char* currentBodyTypeString = bodyTypeStrings[(int)component.Type];
@@ -1,12 +1,26 @@
 #include "Engine/Physics/Physics2D.h"
+#include "Engine/Physics/PhysicsDebugDraw.h"
+#include "Engine/Renderer/Renderer2D.h"
 #include "Engine/Core/Logger.h"
 #include <box2d/box2d.h>
+#include <vector>
 
 namespace Engine {
 
     void* Physics2D::s_PhysicsWorld = nullptr;
     bool Physics2D::s_DebugDraw = false;
 
+    struct RaycastTrace {
+        glm::vec2 Origin;
+        glm::vec2 End;
+        glm::vec2 HitPoint;
+        bool Hit;
+    };
+
+    static Physics2D::DebugDrawOptions s_DebugDrawOptions;
+    static PhysicsDebugDraw s_DebugDrawer;
+    static std::vector<RaycastTrace> s_RaycastTraces;
+
     void Physics2D::Init() {
         // Physics world will be created per-scene
         GE_CORE_INFO("Physics2D initialized");
@@ -16,6 +30,18 @@ namespace Engine {
         GE_CORE_INFO("Physics2D shutdown");
     }
 
+    void Physics2D::SetWorld(void* world) {
+        if (s_PhysicsWorld && s_PhysicsWorld != world)
+            static_cast<b2World*>(s_PhysicsWorld)->SetDebugDraw(nullptr);
+        
+        s_PhysicsWorld = world;
+        s_RaycastTraces.clear();
+    }
+
+    void* Physics2D::GetWorld() {
+        return s_PhysicsWorld;
+    }
+
     void Physics2D::SetGravity(const glm::vec2& gravity) {
         if (s_PhysicsWorld) {
             b2World* world = static_cast<b2World*>(s_PhysicsWorld);
@@ -61,6 +87,9 @@ namespace Engine {
         RaycastCallback callback(hit);
         world->RayCast(&callback, b2Vec2(origin.x, origin.y), b2Vec2(end.x, end.y));
         
+        if (s_DebugDraw && s_DebugDrawOptions.Raycasts)
+            s_RaycastTraces.push_back({ origin, end, hit.Point, hit.Hit });
+        
         return hit;
     }
 
@@ -79,5 +108,44 @@ namespace Engine {
         return s_DebugDraw;
     }
 
+    void Physics2D::SetDebugDrawOptions(const DebugDrawOptions& options) {
+        s_DebugDrawOptions = options;
+    }
+
+    const Physics2D::DebugDrawOptions& Physics2D::GetDebugDrawOptions() {
+        return s_DebugDrawOptions;
+    }
+
+    void Physics2D::DrawDebug() {
+        if (!s_DebugDraw || !s_PhysicsWorld) {
+            s_RaycastTraces.clear();
+            return;
+        }
+        
+        uint32 flags = 0;
+        if (s_DebugDrawOptions.Shapes)       flags |= b2Draw::e_shapeBit;
+        if (s_DebugDrawOptions.AABBs)        flags |= b2Draw::e_aabbBit;
+        if (s_DebugDrawOptions.Joints)       flags |= b2Draw::e_jointBit;
+        if (s_DebugDrawOptions.CenterOfMass) flags |= b2Draw::e_centerOfMassBit;
+        s_DebugDrawer.SetFlags(flags);
+        
+        b2World* world = static_cast<b2World*>(s_PhysicsWorld);
+        world->SetDebugDraw(&s_DebugDrawer);
+        world->DebugDraw();
+        
+        const float z = PhysicsDebugDraw::DepthZ;
+        const glm::vec4 hitColor = { 0.2f, 1.0f, 0.2f, 1.0f };
+        const glm::vec4 missColor = { 1.0f, 0.3f, 0.3f, 1.0f };
+        for (const RaycastTrace& trace : s_RaycastTraces) {
+            if (trace.Hit) {
+                Renderer2D::DrawLine({ trace.Origin, z }, { trace.HitPoint, z }, hitColor);
+                Renderer2D::DrawLine({ trace.HitPoint, z }, { trace.End, z }, missColor * 0.5f);
+            } else {
+                Renderer2D::DrawLine({ trace.Origin, z }, { trace.End, z }, missColor);
+            }
+        }
+        s_RaycastTraces.clear();
+    }
+
 }
 
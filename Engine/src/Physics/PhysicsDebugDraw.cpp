@@ -0,0 +1,66 @@
+#include "Engine/Physics/PhysicsDebugDraw.h"
+#include "Engine/Renderer/Renderer2D.h"
+
+#include <algorithm>
+
+namespace Engine {
+
+    static const uint32_t CircleSegments = 16;
+
+    static glm::vec4 ToColor(const b2Color& color) {
+        return { color.r, color.g, color.b, color.a };
+    }
+
+    static glm::vec3 ToPoint(const b2Vec2& point) {
+        return { point.x, point.y, PhysicsDebugDraw::DepthZ };
+    }
+
+    void PhysicsDebugDraw::DrawPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) {
+        glm::vec3 points[b2_maxPolygonVertices];
+        const uint32_t count = (uint32_t)std::min<int32>(vertexCount, b2_maxPolygonVertices);
+        for (uint32_t i = 0; i < count; i++)
+            points[i] = ToPoint(vertices[i]);
+        
+        Renderer2D::DrawPolygon(points, count, ToColor(color));
+    }
+
+    void PhysicsDebugDraw::DrawSolidPolygon(const b2Vec2* vertices, int32 vertexCount, const b2Color& color) {
+        DrawPolygon(vertices, vertexCount, color);
+    }
+
+    void PhysicsDebugDraw::DrawCircle(const b2Vec2& center, float radius, const b2Color& color) {
+        glm::vec3 points[CircleSegments];
+        for (uint32_t i = 0; i < CircleSegments; i++) {
+            const float angle = (float)i / (float)CircleSegments * 2.0f * b2_pi;
+            points[i] = { center.x + radius * std::cos(angle), center.y + radius * std::sin(angle), DepthZ };
+        }
+        
+        Renderer2D::DrawPolygon(points, CircleSegments, ToColor(color));
+    }
+
+    void PhysicsDebugDraw::DrawSolidCircle(const b2Vec2& center, float radius, const b2Vec2& axis, const b2Color& color) {
+        DrawCircle(center, radius, color);
+        
+        // Radius line shows the body's rotation
+        Renderer2D::DrawLine(ToPoint(center), ToPoint(center + radius * axis), ToColor(color));
+    }
+
+    void PhysicsDebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& color) {
+        Renderer2D::DrawLine(ToPoint(p1), ToPoint(p2), ToColor(color));
+    }
+
+    void PhysicsDebugDraw::DrawTransform(const b2Transform& xf) {
+        const float axisScale = 0.4f;
+        Renderer2D::DrawLine(ToPoint(xf.p), ToPoint(xf.p + axisScale * xf.q.GetXAxis()), { 1.0f, 0.0f, 0.0f, 1.0f });
+        Renderer2D::DrawLine(ToPoint(xf.p), ToPoint(xf.p + axisScale * xf.q.GetYAxis()), { 0.0f, 1.0f, 0.0f, 1.0f });
+    }
+
+    void PhysicsDebugDraw::DrawPoint(const b2Vec2& p, float size, const b2Color& color) {
+        // Size is in pixels; without the viewport scale a small fixed cross will do
+        const float half = 0.05f;
+        const glm::vec4 lineColor = ToColor(color);
+        Renderer2D::DrawLine({ p.x - half, p.y, DepthZ }, { p.x + half, p.y, DepthZ }, lineColor);
+        Renderer2D::DrawLine({ p.x, p.y - half, DepthZ }, { p.x, p.y + half, DepthZ }, lineColor);
+    }
+
+}
@@ -0,0 +1,90 @@
+#include "NullBuffer.h"
+#include "Engine/Renderer/NullRenderer.h"
+#include "Engine/Core/Logger.h"
+
+#include <cstring>
+
+namespace Engine {
+
+    /////////////////////////////////////////////////////////////////////////////
+    // VertexBuffer /////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////
+
+    NullVertexBuffer::NullVertexBuffer(uint32_t size)
+        : m_Size(size) {
+    }
+
+    NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+        : m_Size(size) {
+        auto& counters = NullRenderer::GetCounters();
+        counters.BufferUploads++;
+        counters.BufferUploadBytes += size;
+    }
+
+    void NullVertexBuffer::SetData(const void* data, uint32_t size) {
+        GE_CORE_ASSERT(size <= m_Size, "Vertex buffer upload exceeds buffer size!");
+        auto& counters = NullRenderer::GetCounters();
+        counters.BufferUploads++;
+        counters.BufferUploadBytes += size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // StreamingVertexBuffer ////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////
+
+    NullStreamingVertexBuffer::NullStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+        : m_RegionSize(regionSize), m_RegionCount(regionCount), m_Storage((size_t)regionSize * regionCount) {
+        GE_CORE_ASSERT(regionCount > 0, "Streaming vertex buffer needs at least one region!");
+    }
+
+    void NullStreamingVertexBuffer::SetData(const void* data, uint32_t size) {
+        GE_CORE_ASSERT(size <= m_RegionSize, "Vertex buffer upload exceeds region size!");
+        memcpy(BeginWrite(), data, size);
+        Commit(size);
+    }
+
+    void* NullStreamingVertexBuffer::BeginWrite() {
+        if (!m_Writing) {
+            if (m_Head + m_RegionSize > m_Storage.size())
+                m_Head = 0;
+            m_Writing = true;
+        }
+        
+        return m_Storage.data() + m_Head;
+    }
+
+    uint32_t NullStreamingVertexBuffer::Commit(uint32_t size) {
+        GE_CORE_ASSERT(m_Writing, "Commit without BeginWrite!");
+        GE_CORE_ASSERT(size <= m_RegionSize, "Vertex buffer write exceeds region size!");
+        
+        auto& counters = NullRenderer::GetCounters();
+        counters.BufferUploads++;
+        counters.BufferUploadBytes += size;
+        
+        const uint32_t offset = m_Head;
+        m_Head += size;
+        m_Writing = false;
+        return offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // IndexBuffer //////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////
+
+    NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+        : m_Count(count) {
+        auto& counters = NullRenderer::GetCounters();
+        counters.BufferUploads++;
+        counters.BufferUploadBytes += count * sizeof(uint32_t);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    // VertexArray //////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////
+
+    void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
+        GE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+        m_VertexBuffers.push_back(vertexBuffer);
+    }
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Engine/Renderer/Buffer.h"
+
+namespace Engine {
+
+    class NullVertexBuffer : public VertexBuffer {
+    public:
+        NullVertexBuffer(uint32_t size);
+        NullVertexBuffer(float* vertices, uint32_t size);
+        virtual ~NullVertexBuffer() = default;
+        
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+        
+        virtual void SetData(const void* data, uint32_t size) override;
+        
+        virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+        
+    private:
+        uint32_t m_Size;
+        BufferLayout m_Layout;
+    };
+
+    // CPU-side regions; commits are counted as uploads so both paths compare in the counters
+    class NullStreamingVertexBuffer : public StreamingVertexBuffer {
+    public:
+        NullStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+        virtual ~NullStreamingVertexBuffer() = default;
+        
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+        
+        virtual void SetData(const void* data, uint32_t size) override;
+        
+        virtual void* BeginWrite() override;
+        virtual uint32_t Commit(uint32_t size) override;
+        
+        virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+        
+        virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+        
+    private:
+        uint32_t m_RegionSize;
+        uint32_t m_RegionCount;
+        uint32_t m_Head = 0;
+        bool m_Writing = false;
+        std::vector<uint8_t> m_Storage;
+        BufferLayout m_Layout;
+    };
+
+    class NullIndexBuffer : public IndexBuffer {
+    public:
+        NullIndexBuffer(uint32_t* indices, uint32_t count);
+        virtual ~NullIndexBuffer() = default;
+        
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+        
+        virtual uint32_t GetCount() const override { return m_Count; }
+        
+    private:
+        uint32_t m_Count;
+    };
+
+    class NullVertexArray : public VertexArray {
+    public:
+        NullVertexArray() = default;
+        virtual ~NullVertexArray() = default;
+        
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+        
+        virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+        
+        virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+        virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+        
+    private:
+        std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+        Ref<IndexBuffer> m_IndexBuffer;
+    };
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Renderer/Framebuffer.h"
+
+namespace Engine {
+
+    class NullFramebuffer : public Framebuffer {
+    public:
+        NullFramebuffer(const FramebufferSpecification& spec)
+            : m_Specification(spec), m_CapacityWidth(spec.Width), m_CapacityHeight(spec.Height) {
+        }
+
+        virtual void Bind() override {}
+        virtual void Unbind() override {}
+
+        virtual void Resize(uint32_t width, uint32_t height) override {
+            m_Specification.Width = width;
+            m_Specification.Height = height;
+            m_CapacityWidth = ComputeCapacity(m_CapacityWidth, width);
+            m_CapacityHeight = ComputeCapacity(m_CapacityHeight, height);
+        }
+
+        virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override { return -1; }
+        virtual void ClearAttachment(uint32_t attachmentIndex, int value) override {}
+
+        virtual uint32_t GetColorAttachmentRendererID(uint32_t index) const override { return 0; }
+        virtual uint32_t GetDepthAttachmentRendererID() const override { return 0; }
+
+        virtual uint32_t GetCapacityWidth() const override { return m_CapacityWidth; }
+        virtual uint32_t GetCapacityHeight() const override { return m_CapacityHeight; }
+
+        virtual const FramebufferSpecification& GetSpecification() const override {
+            return m_Specification;
+        }
+
+    private:
+        FramebufferSpecification m_Specification;
+        uint32_t m_CapacityWidth, m_CapacityHeight;
+    };
+
+} // namespace Engine
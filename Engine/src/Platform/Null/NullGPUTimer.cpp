@@ -0,0 +1,23 @@
+#include "NullGPUTimer.h"
+
+namespace Engine {
+
+    void NullGPUTimer::BeginPass(const std::string& name) {
+        // Nested passes are folded into the outer one, as on the GL timer
+        if (m_PassDepth++ == 0)
+            m_Passes.push_back(name);
+    }
+
+    void NullGPUTimer::EndPass() {
+        if (m_PassDepth > 0)
+            m_PassDepth--;
+    }
+
+    void NullGPUTimer::EndFrame(std::vector<GPUTimerResult>& outResults) {
+        for (const std::string& name : m_Passes)
+            outResults.push_back({ name, 0.0f });
+        m_Passes.clear();
+        m_PassDepth = 0;
+    }
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Engine/Renderer/GPUTimer.h"
+
+namespace Engine {
+
+    // No-op fallback for the Null backend and GL contexts without timer queries:
+    // passes are reported by name with zero duration at the end of their frame
+    class NullGPUTimer : public GPUTimer {
+    public:
+        virtual bool IsSupported() const override { return false; }
+
+        virtual void BeginPass(const std::string& name) override;
+        virtual void EndPass() override;
+
+        virtual void EndFrame(std::vector<GPUTimerResult>& outResults) override;
+
+    private:
+        std::vector<std::string> m_Passes;
+        uint32_t m_PassDepth = 0;
+    };
+
+}
@@ -0,0 +1,66 @@
+#include "NullRendererAPI.h"
+#include "Engine/Renderer/NullRenderer.h"
+#include "Engine/Core/Logger.h"
+
+namespace Engine {
+
+    static NullRenderer::Counters s_Counters;
+
+    NullRenderer::Counters& NullRenderer::GetCounters() {
+        return s_Counters;
+    }
+
+    void NullRenderer::ResetCounters() {
+        s_Counters = Counters();
+    }
+
+    void NullRendererAPI::Init() {
+        GE_CORE_INFO("Null renderer initialized (headless, no GPU calls will be issued)");
+        NullRenderer::ResetCounters();
+    }
+
+    void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    }
+
+    void NullRendererAPI::SetClearColor(const glm::vec4& color) {
+    }
+
+    void NullRendererAPI::Clear() {
+        s_Counters.Clears++;
+    }
+
+    void NullRendererAPI::SetBlend(bool enabled) {
+    }
+
+    void NullRendererAPI::SetDepthWrite(bool enabled) {
+    }
+
+    void NullRendererAPI::SetDepthLessEqual(bool enabled) {
+    }
+
+    void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex) {
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        s_Counters.DrawCalls++;
+        s_Counters.IndicesDrawn += count;
+    }
+
+    void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) {
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        s_Counters.DrawCalls++;
+        s_Counters.InstancesDrawn += instanceCount;
+        s_Counters.IndicesDrawn += (uint64_t)count * instanceCount;
+    }
+
+    void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+        s_Counters.DrawCalls++;
+    }
+
+    // No GL state to track; binds are counted in NullRenderer::Counters instead
+    RendererAPI::StateChangeStats NullRendererAPI::GetStateChangeStats() const {
+        return StateChangeStats();
+    }
+
+    void NullRendererAPI::ResetStateChangeStats() {
+    }
+
+}
@@ -0,0 +1,23 @@
+#include "NullShader.h"
+#include "Engine/Renderer/NullRenderer.h"
+
+namespace Engine {
+
+    NullShader::NullShader(const std::string& filepathOrName) {
+        // Same naming rule as OpenGLShader so asset lookups behave identically
+        auto lastSlash = filepathOrName.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+        auto lastDot = filepathOrName.rfind('.');
+        auto count = (lastDot == std::string::npos || lastDot < lastSlash) ? filepathOrName.size() - lastSlash : lastDot - lastSlash;
+        m_Name = filepathOrName.substr(lastSlash, count);
+    }
+
+    void NullShader::Bind() const {
+        NullRenderer::GetCounters().ShaderBinds++;
+    }
+
+    void NullShader::CountUniform() {
+        NullRenderer::GetCounters().UniformUploads++;
+    }
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Engine/Renderer/Shader.h"
+
+namespace Engine {
+
+    class NullShader : public Shader {
+    public:
+        NullShader(const std::string& filepathOrName);
+        virtual ~NullShader() = default;
+        
+        virtual void Bind() const override;
+        virtual void Unbind() const override {}
+        
+        virtual void SetInt(const std::string& name, int value) override { CountUniform(); }
+        virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override { CountUniform(); }
+        virtual void SetFloat(const std::string& name, float value) override { CountUniform(); }
+        virtual void SetFloat2(const std::string& name, const glm::vec2& value) override { CountUniform(); }
+        virtual void SetFloat3(const std::string& name, const glm::vec3& value) override { CountUniform(); }
+        virtual void SetFloat4(const std::string& name, const glm::vec4& value) override { CountUniform(); }
+        virtual void SetMat3(const std::string& name, const glm::mat3& value) override { CountUniform(); }
+        virtual void SetMat4(const std::string& name, const glm::mat4& value) override { CountUniform(); }
+        
+        virtual const std::string& GetName() const override { return m_Name; }
+        
+    private:
+        void CountUniform();
+        
+    private:
+        std::string m_Name;
+    };
+
+}
@@ -0,0 +1,109 @@
+#include "NullTexture.h"
+#include "Engine/Renderer/NullRenderer.h"
+#include "Engine/Renderer/CompressedImage.h"
+#include "Engine/Core/Logger.h"
+
+#include <stb_image.h>
+#include <cmath>
+
+namespace Engine {
+
+    // Hand out unique IDs so batching still tells textures apart
+    static uint32_t s_NextRendererID = 1;
+
+    NullTexture2D::NullTexture2D(uint32_t width, uint32_t height)
+        : m_IsLoaded(true), m_Width(width), m_Height(height), m_RendererID(s_NextRendererID++) {
+    }
+
+    NullTexture2D::NullTexture2D(const std::string& path, const TextureSpecification& specification)
+        : m_Path(path), m_RendererID(s_NextRendererID++) {
+        if (CompressedImage::IsCompressedPath(path)) {
+            CompressedImage image;
+            if (CompressedImage::LoadDDS(path, image)) {
+                m_IsLoaded = true;
+                m_Width = image.Width;
+                m_Height = image.Height;
+                m_Format = image.Format;
+                m_MipCount = (uint32_t)image.Levels.size();
+                
+                auto& counters = NullRenderer::GetCounters();
+                counters.TextureUploads++;
+                counters.TextureUploadBytes += image.Data.size();
+            }
+            return;
+        }
+        
+        // Only read the header: dimensions matter for atlases and stats, pixels don't
+        int width, height, channels;
+        if (stbi_info(path.c_str(), &width, &height, &channels)) {
+            m_IsLoaded = true;
+            m_Width = width;
+            m_Height = height;
+            m_Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
+            if (specification.GenerateMips)
+                m_MipCount = 1 + (uint32_t)std::floor(std::log2((float)std::max(m_Width, m_Height)));
+            
+            auto& counters = NullRenderer::GetCounters();
+            counters.TextureUploads++;
+            counters.TextureUploadBytes += (uint64_t)m_Width * m_Height * channels;
+        } else {
+            GE_CORE_ERROR("Failed to load texture: {0}", path);
+        }
+    }
+
+    void NullTexture2D::SetData(void* data, uint32_t size) {
+        auto& counters = NullRenderer::GetCounters();
+        counters.TextureUploads++;
+        counters.TextureUploadBytes += size;
+    }
+
+    void NullTexture2D::SetSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        GE_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "Sub-region exceeds texture bounds!");
+        auto& counters = NullRenderer::GetCounters();
+        counters.TextureUploads++;
+        counters.TextureUploadBytes += (uint64_t)width * height * 4;
+    }
+
+    void NullTexture2D::Bind(uint32_t slot) const {
+        NullRenderer::GetCounters().TextureBinds++;
+    }
+
+    void NullTexture2D::MarkPending(const std::string& path) {
+        m_Path = path;
+        m_IsLoaded = false;
+        m_IsReady = false;
+    }
+
+    void NullTexture2D::MarkReady(bool loaded, uint32_t width, uint32_t height, uint32_t channels, bool generateMips) {
+        m_IsLoaded = loaded;
+        m_IsReady = true;
+        
+        if (loaded) {
+            m_Width = width;
+            m_Height = height;
+            m_Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
+            if (generateMips)
+                m_MipCount = 1 + (uint32_t)std::floor(std::log2((float)std::max(m_Width, m_Height)));
+            
+            auto& counters = NullRenderer::GetCounters();
+            counters.TextureUploads++;
+            counters.TextureUploadBytes += (uint64_t)m_Width * m_Height * channels;
+        }
+    }
+
+    NullTexture2DArray::NullTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+        : m_Width(width), m_Height(height), m_LayerCount(layers), m_RendererID(s_NextRendererID++) {
+    }
+
+    void NullTexture2DArray::SetLayerData(uint32_t layer, const void* data) {
+        GE_CORE_ASSERT(layer < m_LayerCount, "Texture array layer out of range!");
+        auto& counters = NullRenderer::GetCounters();
+        counters.TextureUploads++;
+        counters.TextureUploadBytes += (uint64_t)m_Width * m_Height * 4;
+    }
+
+    void NullTexture2DArray::Bind(uint32_t slot) const {
+        NullRenderer::GetCounters().TextureBinds++;
+    }
+
+}
@@ -0,0 +1,22 @@
+#include "NullTextureUploader.h"
+#include "NullTexture.h"
+
+namespace Engine {
+
+    Ref<Texture2D> NullTextureUploader::CreatePlaceholder(const std::string& path) {
+        Ref<NullTexture2D> texture = CreateRef<NullTexture2D>(1, 1);
+        texture->MarkPending(path);
+        return texture;
+    }
+
+    bool NullTextureUploader::Upload(const Ref<Texture2D>& texture, const void* pixels, uint32_t width, uint32_t height,
+                                     uint32_t channels, const TextureSpecification& specification) {
+        static_cast<NullTexture2D&>(*texture).MarkReady(true, width, height, channels, specification.GenerateMips);
+        return true;
+    }
+
+    void NullTextureUploader::Fail(const Ref<Texture2D>& texture) {
+        static_cast<NullTexture2D&>(*texture).MarkReady(false);
+    }
+
+}
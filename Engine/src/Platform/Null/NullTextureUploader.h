@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Engine/Renderer/TextureUploadQueue.h"
+
+namespace Engine {
+
+    // Finishes every upload immediately and only records its size in the counters
+    class NullTextureUploader : public TextureUploader {
+    public:
+        virtual Ref<Texture2D> CreatePlaceholder(const std::string& path) override;
+
+        virtual void BeginFrame() override {}
+        virtual bool Upload(const Ref<Texture2D>& texture, const void* pixels, uint32_t width, uint32_t height,
+                            uint32_t channels, const TextureSpecification& specification) override;
+        virtual void Fail(const Ref<Texture2D>& texture) override;
+    };
+
+}
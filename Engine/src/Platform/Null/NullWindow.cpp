@@ -0,0 +1,22 @@
+#include "NullWindow.h"
+#include "Engine/Renderer/NullRenderer.h"
+#include "Engine/Core/Logger.h"
+
+namespace Engine {
+
+    NullWindow::NullWindow(const WindowProps& props)
+        : m_Width(props.Width), m_Height(props.Height), m_VSync(false),
+          m_StartTime(std::chrono::steady_clock::now()) {
+        GE_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+    }
+
+    void NullWindow::OnUpdate() {
+        NullRenderer::GetCounters().Frames++;
+    }
+
+    float NullWindow::GetTime() const {
+        std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - m_StartTime;
+        return elapsed.count();
+    }
+
+}
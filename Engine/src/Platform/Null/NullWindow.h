@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Engine/Core/Window.h"
+#include <chrono>
+
+namespace Engine {
+
+    // Window stand-in for headless runs: no GLFW, no GL context, no events
+    class NullWindow : public Window {
+    public:
+        NullWindow(const WindowProps& props);
+        virtual ~NullWindow() = default;
+        
+        void OnUpdate() override;
+        
+        uint32_t GetWidth() const override { return m_Width; }
+        uint32_t GetHeight() const override { return m_Height; }
+        
+        void SetEventCallback(const EventCallbackFn& callback) override { m_EventCallback = callback; }
+        void SetVSync(bool enabled) override { m_VSync = enabled; }
+        bool IsVSync() const override { return m_VSync; }
+        
+        void* GetNativeWindow() const override { return nullptr; }
+        
+        float GetTime() const override;
+        
+    private:
+        uint32_t m_Width, m_Height;
+        bool m_VSync;
+        EventCallbackFn m_EventCallback;
+        std::chrono::steady_clock::time_point m_StartTime;
+    };
+
+}
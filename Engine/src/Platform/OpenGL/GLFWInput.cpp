@@ -7,18 +7,24 @@ namespace Engine {
 
     bool Input::IsKeyPressed(KeyCode keycode) {
         auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return false; // Headless
         auto state = glfwGetKey(window, static_cast<int32_t>(keycode));
         return state == GLFW_PRESS || state == GLFW_REPEAT;
     }
 
     bool Input::IsMouseButtonPressed(MouseButton button) {
         auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return false; // Headless
         auto state = glfwGetMouseButton(window, static_cast<int32_t>(button));
         return state == GLFW_PRESS;
     }
 
     glm::vec2 Input::GetMousePosition() {
         auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+        if (!window)
+            return { 0.0f, 0.0f }; // Headless
         double xpos, ypos;
         glfwGetCursorPos(window, &xpos, &ypos);
         return { (float)xpos, (float)ypos };
@@ -15,10 +15,6 @@ namespace Engine {
         GE_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
     }
 
-    Scope<Window> Window::Create(const WindowProps& props) {
-        return CreateScope<GLFWWindow>(props);
-    }
-
     GLFWWindow::GLFWWindow(const WindowProps& props) {
         Init(props);
     }
@@ -163,6 +159,10 @@ namespace Engine {
         glfwSwapBuffers(m_Window);
     }
 
+    float GLFWWindow::GetTime() const {
+        return (float)glfwGetTime();
+    }
+
     void GLFWWindow::SetVSync(bool enabled) {
         if (enabled)
             glfwSwapInterval(1);
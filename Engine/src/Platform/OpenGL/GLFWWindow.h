@@ -24,6 +24,8 @@ namespace Engine {
         
         void* GetNativeWindow() const override { return m_Window; }
         
+        float GetTime() const override;
+        
     private:
         void Init(const WindowProps& props);
         void Shutdown();
@@ -1,7 +1,9 @@
 #include "OpenGLBuffer.h"
+#include "OpenGLStateCache.h"
 #include "Engine/Core/Logger.h"
 
 #include <glad/glad.h>
+#include <cstring>
 
 namespace Engine {
 
@@ -11,39 +13,184 @@ namespace Engine {
 
     OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size) {
         glGenBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
         glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
     }
 
     OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size) {
         glGenBuffers(1, &m_RendererID);
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
         glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer() {
+        OpenGLStateCache::OnBufferDeleted(m_RendererID);
         glDeleteBuffers(1, &m_RendererID);
     }
 
     void OpenGLVertexBuffer::Bind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
     }
 
     void OpenGLVertexBuffer::Unbind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        OpenGLStateCache::BindArrayBuffer(0);
     }
 
     void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
-        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
         glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
     }
 
-    Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
-        return CreateRef<OpenGLVertexBuffer>(size);
+    /////////////////////////////////////////////////////////////////////////////
+    // StreamingVertexBuffer ////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////
+
+    OpenGLStreamingVertexBuffer::OpenGLStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount)
+        : m_RegionSize(regionSize), m_RegionCount(regionCount), m_Fences(regionCount, nullptr) {
+        GE_CORE_ASSERT(regionCount > 0, "Streaming vertex buffer needs at least one region!");
+        
+        const GLsizeiptr totalSize = (GLsizeiptr)regionSize * regionCount;
+        m_Persistent = GLAD_GL_ARB_buffer_storage != 0;
+        
+        glGenBuffers(1, &m_RendererID);
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
+        
+        if (m_Persistent) {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, totalSize, nullptr, flags);
+            m_PersistentBase = (uint8_t*)glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags);
+            if (!m_PersistentBase) {
+                GE_CORE_WARN("Persistent vertex buffer mapping failed, falling back to orphaning");
+                OpenGLStateCache::OnBufferDeleted(m_RendererID);
+                glDeleteBuffers(1, &m_RendererID);
+                glGenBuffers(1, &m_RendererID);
+                OpenGLStateCache::BindArrayBuffer(m_RendererID);
+                m_Persistent = false;
+            }
+        }
+        
+        if (!m_Persistent)
+            glBufferData(GL_ARRAY_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+    }
+
+    OpenGLStreamingVertexBuffer::~OpenGLStreamingVertexBuffer() {
+        for (void* fence : m_Fences) {
+            if (fence)
+                glDeleteSync((GLsync)fence);
+        }
+        
+        if (m_Persistent || m_Writing) {
+            OpenGLStateCache::BindArrayBuffer(m_RendererID);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+        OpenGLStateCache::OnBufferDeleted(m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void OpenGLStreamingVertexBuffer::Bind() const {
+        OpenGLStateCache::BindArrayBuffer(m_RendererID);
+    }
+
+    void OpenGLStreamingVertexBuffer::Unbind() const {
+        OpenGLStateCache::BindArrayBuffer(0);
+    }
+
+    void OpenGLStreamingVertexBuffer::SetData(const void* data, uint32_t size) {
+        GE_CORE_ASSERT(size <= m_RegionSize, "Vertex buffer upload exceeds region size!");
+        memcpy(BeginWrite(), data, size);
+        Commit(size);
+    }
+
+    void OpenGLStreamingVertexBuffer::FenceRegion(uint32_t region) {
+        if (m_Persistent)
+            m_Fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     }
 
-    Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
-        return CreateRef<OpenGLVertexBuffer>(vertices, size);
+    void OpenGLStreamingVertexBuffer::WaitForRegion(uint32_t region) {
+        GLsync fence = (GLsync)m_Fences[region];
+        if (!fence)
+            return;
+        
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            // The GPU is still reading what we wrote a full ring ago
+            m_StallCount++;
+            if (m_StallCount == 1)
+                GE_CORE_WARN("Streaming vertex buffer waited on the GPU; {0} regions of {1} bytes are too few for a frame",
+                             m_RegionCount, m_RegionSize);
+            
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, MaxFenceWait);
+            if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) {
+                GE_CORE_ERROR("Streaming vertex buffer fence did not signal, finishing the GPU");
+                glFinish();
+            }
+        }
+        
+        glDeleteSync(fence);
+        m_Fences[region] = nullptr;
+    }
+
+    void* OpenGLStreamingVertexBuffer::BeginWrite() {
+        if (m_Writing)
+            return m_WritePtr;
+        
+        const uint32_t bufferSize = m_RegionSize * m_RegionCount;
+        
+        // Batches go back to back; wrap once a full region no longer fits. The draws
+        // reading everything before the head have been issued by now.
+        bool wrapped = false;
+        if (m_Head + m_RegionSize > bufferSize) {
+            for (uint32_t region = m_OpenBegin; region < m_OpenEnd; region++)
+                FenceRegion(region);
+            m_OpenBegin = m_OpenEnd = 0;
+            m_Head = 0;
+            wrapped = true;
+        }
+        
+        // Fence the regions the head has left and wait for the ones it is about to
+        // enter, so there is one fence per region per lap rather than per batch
+        const uint32_t first = m_Head / m_RegionSize;
+        const uint32_t last = (m_Head + m_RegionSize - 1) / m_RegionSize;
+        for (; m_OpenBegin < m_OpenEnd && m_OpenBegin < first; m_OpenBegin++)
+            FenceRegion(m_OpenBegin);
+        if (m_OpenBegin == m_OpenEnd)
+            m_OpenBegin = m_OpenEnd = first;
+        for (; m_OpenEnd <= last; m_OpenEnd++)
+            WaitForRegion(m_OpenEnd);
+        
+        if (m_Persistent) {
+            m_WritePtr = m_PersistentBase + m_Head;
+        } else {
+            OpenGLStateCache::BindArrayBuffer(m_RendererID);
+            
+            // Wrapping around: hand the old storage to the driver instead of waiting on it
+            if (wrapped)
+                glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)bufferSize, nullptr, GL_STREAM_DRAW);
+            
+            m_WritePtr = (uint8_t*)glMapBufferRange(GL_ARRAY_BUFFER, m_Head, m_RegionSize,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+            GE_CORE_ASSERT(m_WritePtr, "Failed to map streaming vertex buffer!");
+        }
+        
+        m_Writing = true;
+        return m_WritePtr;
+    }
+
+    uint32_t OpenGLStreamingVertexBuffer::Commit(uint32_t size) {
+        GE_CORE_ASSERT(m_Writing, "Commit without BeginWrite!");
+        GE_CORE_ASSERT(size <= m_RegionSize, "Vertex buffer write exceeds region size!");
+        
+        if (!m_Persistent) {
+            OpenGLStateCache::BindArrayBuffer(m_RendererID);
+            if (size)
+                glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, size);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+        
+        const uint32_t offset = m_Head;
+        m_Head += size;
+        m_Writing = false;
+        return offset;
     }
 
     /////////////////////////////////////////////////////////////////////////////
@@ -69,10 +216,6 @@ namespace Engine {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 
-    Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
-        return CreateRef<OpenGLIndexBuffer>(indices, count);
-    }
-
     /////////////////////////////////////////////////////////////////////////////
     // VertexArray //////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////
@@ -90,6 +233,9 @@ namespace Engine {
             case ShaderDataType::Int3:     return GL_INT;
             case ShaderDataType::Int4:     return GL_INT;
             case ShaderDataType::Bool:     return GL_BOOL;
+            case ShaderDataType::UByte4:   return GL_UNSIGNED_BYTE;
+            case ShaderDataType::UShort2:  return GL_UNSIGNED_SHORT;
+            case ShaderDataType::UInt:     return GL_UNSIGNED_INT;
             default: break;
         }
         
@@ -97,37 +243,54 @@ namespace Engine {
         return 0;
     }
 
+    // Packed types read as integers unless normalized. The older Int types keep
+    // their float conversion.
+    static bool IsPackedIntegerType(ShaderDataType type) {
+        return type == ShaderDataType::UByte4 || type == ShaderDataType::UShort2 || type == ShaderDataType::UInt;
+    }
+
     OpenGLVertexArray::OpenGLVertexArray() {
         glGenVertexArrays(1, &m_RendererID);
     }
 
     OpenGLVertexArray::~OpenGLVertexArray() {
+        OpenGLStateCache::OnVertexArrayDeleted(m_RendererID);
         glDeleteVertexArrays(1, &m_RendererID);
     }
 
     void OpenGLVertexArray::Bind() const {
-        glBindVertexArray(m_RendererID);
+        OpenGLStateCache::BindVertexArray(m_RendererID);
     }
 
     void OpenGLVertexArray::Unbind() const {
-        glBindVertexArray(0);
+        OpenGLStateCache::BindVertexArray(0);
     }
 
     void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
         GE_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
         
-        glBindVertexArray(m_RendererID);
+        OpenGLStateCache::BindVertexArray(m_RendererID);
         vertexBuffer->Bind();
         
         const auto& layout = vertexBuffer->GetLayout();
         for (const auto& element : layout) {
             glEnableVertexAttribArray(m_VertexBufferIndex);
-            glVertexAttribPointer(m_VertexBufferIndex,
-                element.GetComponentCount(),
-                ShaderDataTypeToOpenGLBaseType(element.Type),
-                element.Normalized ? GL_TRUE : GL_FALSE,
-                layout.GetStride(),
-                (const void*)(intptr_t)element.Offset);
+            if (IsPackedIntegerType(element.Type) && !element.Normalized) {
+                glVertexAttribIPointer(m_VertexBufferIndex,
+                    element.GetComponentCount(),
+                    ShaderDataTypeToOpenGLBaseType(element.Type),
+                    layout.GetStride(),
+                    (const void*)(intptr_t)element.Offset);
+            } else {
+                glVertexAttribPointer(m_VertexBufferIndex,
+                    element.GetComponentCount(),
+                    ShaderDataTypeToOpenGLBaseType(element.Type),
+                    element.Normalized ? GL_TRUE : GL_FALSE,
+                    layout.GetStride(),
+                    (const void*)(intptr_t)element.Offset);
+            }
+            if (element.Divisor)
+                glVertexAttribDivisor(m_VertexBufferIndex, element.Divisor);
             m_VertexBufferIndex++;
         }
         
@@ -135,15 +298,11 @@ namespace Engine {
     }
 
     void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-        glBindVertexArray(m_RendererID);
+        OpenGLStateCache::BindVertexArray(m_RendererID);
         indexBuffer->Bind();
         
         m_IndexBuffer = indexBuffer;
     }
 
-    Ref<VertexArray> VertexArray::Create() {
-        return CreateRef<OpenGLVertexArray>();
-    }
-
 }
 
@@ -23,6 +23,50 @@ namespace Engine {
         BufferLayout m_Layout;
     };
 
+    // Persistently mapped (ARB_buffer_storage) with a fence per region when available,
+    // otherwise unsynchronized range maps that orphan the buffer on wrap-around.
+    // Regions currently under the write head are "open": already waited on, and fenced
+    // again once the head has moved past them.
+    class OpenGLStreamingVertexBuffer : public StreamingVertexBuffer {
+    public:
+        OpenGLStreamingVertexBuffer(uint32_t regionSize, uint32_t regionCount);
+        virtual ~OpenGLStreamingVertexBuffer();
+        
+        virtual void Bind() const override;
+        virtual void Unbind() const override;
+        
+        virtual void SetData(const void* data, uint32_t size) override;
+        
+        virtual void* BeginWrite() override;
+        virtual uint32_t Commit(uint32_t size) override;
+        
+        virtual uint32_t GetRegionSize() const override { return m_RegionSize; }
+        
+        virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+        virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+        
+    private:
+        void FenceRegion(uint32_t region);
+        // Bounded: logs the first stall, and finishes the GPU if the fence never signals
+        void WaitForRegion(uint32_t region);
+        
+    private:
+        static const uint64_t MaxFenceWait = 100000000; // ns
+        
+        uint32_t m_RendererID;
+        uint32_t m_RegionSize;
+        uint32_t m_RegionCount;
+        uint32_t m_Head = 0;        // Byte offset of the next batch
+        uint32_t m_OpenBegin = 0, m_OpenEnd = 0;
+        uint32_t m_StallCount = 0;
+        bool m_Persistent = false;
+        bool m_Writing = false;
+        uint8_t* m_PersistentBase = nullptr;
+        uint8_t* m_WritePtr = nullptr;
+        std::vector<void*> m_Fences; // GLsync per region
+        BufferLayout m_Layout;
+    };
+
     class OpenGLIndexBuffer : public IndexBuffer {
     public:
         OpenGLIndexBuffer(uint32_t* indices, uint32_t count);
@@ -0,0 +1,87 @@
+#include "OpenGLGPUTimer.h"
+#include "Engine/Core/Logger.h"
+
+#include <glad/glad.h>
+
+namespace Engine {
+
+    bool OpenGLGPUTimer::IsAvailable() {
+        return GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query;
+    }
+
+    OpenGLGPUTimer::OpenGLGPUTimer(uint32_t latency)
+        : m_Frames(latency + 1) {
+    }
+
+    OpenGLGPUTimer::~OpenGLGPUTimer() {
+        if (m_PassDepth > 0)
+            glEndQuery(GL_TIME_ELAPSED);
+
+        for (auto& frame : m_Frames) {
+            for (PendingPass& pass : frame)
+                m_FreeQueries.push_back(pass.Query);
+        }
+
+        if (!m_FreeQueries.empty())
+            glDeleteQueries((GLsizei)m_FreeQueries.size(), m_FreeQueries.data());
+    }
+
+    void OpenGLGPUTimer::BeginPass(const std::string& name) {
+        // Only one GL_TIME_ELAPSED query can be active at a time, so a nested pass
+        // just raises the depth and its EndPass lowers it again
+        if (m_PassDepth++ > 0) {
+            if (!m_WarnedNesting) {
+                GE_CORE_WARN("GPU pass '{0}' started inside another pass, ignoring nested GPU passes", name);
+                m_WarnedNesting = true;
+            }
+            return;
+        }
+
+        uint32_t query;
+        if (m_FreeQueries.empty()) {
+            glGenQueries(1, &query);
+        } else {
+            query = m_FreeQueries.back();
+            m_FreeQueries.pop_back();
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, query);
+        m_Frames[m_Frame].push_back({ name, query });
+    }
+
+    void OpenGLGPUTimer::EndPass() {
+        // Unmatched EndPass
+        if (m_PassDepth == 0)
+            return;
+
+        if (--m_PassDepth == 0)
+            glEndQuery(GL_TIME_ELAPSED);
+    }
+
+    void OpenGLGPUTimer::EndFrame(std::vector<GPUTimerResult>& outResults) {
+        // Close a pass left open, however deep
+        if (m_PassDepth > 0) {
+            glEndQuery(GL_TIME_ELAPSED);
+            m_PassDepth = 0;
+        }
+
+        // The next slot holds the oldest frame, Latency frames back
+        m_Frame = (m_Frame + 1) % (uint32_t)m_Frames.size();
+        std::vector<PendingPass>& oldest = m_Frames[m_Frame];
+
+        for (PendingPass& pass : oldest) {
+            GLint available = 0;
+            glGetQueryObjectiv(pass.Query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available) {
+                GLuint64 nanoseconds = 0;
+                glGetQueryObjectui64v(pass.Query, GL_QUERY_RESULT, &nanoseconds);
+                outResults.push_back({ pass.Name, nanoseconds / 1000000.0f });
+            }
+
+            // Reissuing a query discards a result nobody read
+            m_FreeQueries.push_back(pass.Query);
+        }
+        oldest.clear();
+    }
+
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Engine/Renderer/GPUTimer.h"
+
+namespace Engine {
+
+    // GL_TIME_ELAPSED queries from a pool that grows on demand. Each frame keeps its
+    // queries in a ring of Latency + 1 slots; a slot is read back just before it is
+    // reused, and a query that still isn't available then is dropped, not waited on.
+    class OpenGLGPUTimer : public GPUTimer {
+    public:
+        OpenGLGPUTimer(uint32_t latency);
+        virtual ~OpenGLGPUTimer();
+
+        virtual bool IsSupported() const override { return true; }
+
+        virtual void BeginPass(const std::string& name) override;
+        virtual void EndPass() override;
+
+        virtual void EndFrame(std::vector<GPUTimerResult>& outResults) override;
+
+        // Timer queries are core since 3.3, otherwise ARB_timer_query
+        static bool IsAvailable();
+
+    private:
+        struct PendingPass {
+            std::string Name;
+            uint32_t Query;
+        };
+
+        std::vector<std::vector<PendingPass>> m_Frames;
+        uint32_t m_Frame = 0;
+        std::vector<uint32_t> m_FreeQueries;
+        uint32_t m_PassDepth = 0;   // Begun minus ended passes; only depth 0 owns the query
+        bool m_WarnedNesting = false;
+    };
+
+}
@@ -1,4 +1,5 @@
 #include "OpenGLRendererAPI.h"
+#include "OpenGLStateCache.h"
 #include "Engine/Core/Logger.h"
 
 #include <glad/glad.h>
@@ -32,10 +33,13 @@ namespace Engine {
         glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
     #endif
         
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        OpenGLStateCache::Invalidate();
+        OpenGLStateCache::SetBlend(true);
+        OpenGLStateCache::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         
-        glEnable(GL_DEPTH_TEST);
+        OpenGLStateCache::SetDepthTest(true);
+        OpenGLStateCache::SetDepthWrite(true);
+        OpenGLStateCache::SetDepthFunc(GL_LESS);
     }
 
     void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
@@ -50,10 +54,41 @@ namespace Engine {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
-    void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+    void OpenGLRendererAPI::SetBlend(bool enabled) {
+        OpenGLStateCache::SetBlend(enabled);
+    }
+
+    void OpenGLRendererAPI::SetDepthWrite(bool enabled) {
+        OpenGLStateCache::SetDepthWrite(enabled);
+    }
+
+    void OpenGLRendererAPI::SetDepthLessEqual(bool enabled) {
+        OpenGLStateCache::SetDepthFunc(enabled ? GL_LEQUAL : GL_LESS);
+    }
+
+    void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex) {
         uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
-        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+        if (baseVertex)
+            glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, (GLint)baseVertex);
+        else
+            glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
     }
 
-}
+    void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) {
+        uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+        glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+    }
+
+    void OpenGLRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+        glDrawArrays(GL_LINES, (GLint)firstVertex, vertexCount);
+    }
+
+    RendererAPI::StateChangeStats OpenGLRendererAPI::GetStateChangeStats() const {
+        return OpenGLStateCache::GetStats();
+    }
+
+    void OpenGLRendererAPI::ResetStateChangeStats() {
+        OpenGLStateCache::GetStats() = StateChangeStats();
+    }
 
+}
@@ -10,8 +10,16 @@ namespace Engine {
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
         virtual void SetClearColor(const glm::vec4& color) override;
         virtual void Clear() override;
+        virtual void SetBlend(bool enabled) override;
+        virtual void SetDepthWrite(bool enabled) override;
+        virtual void SetDepthLessEqual(bool enabled) override;
         
-        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+        virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+        virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount) override;
+        virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+        
+        virtual StateChangeStats GetStateChangeStats() const override;
+        virtual void ResetStateChangeStats() override;
     };
 
 }
@@ -0,0 +1,208 @@
+#include "OpenGLShader.h"
+#include "OpenGLStateCache.h"
+#include "Engine/Core/Logger.h"
+
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <fstream>
+#include <sstream>
+
+namespace Engine {
+
+    static GLenum ShaderTypeFromString(const std::string& type) {
+        if (type == "vertex")
+            return GL_VERTEX_SHADER;
+        if (type == "fragment" || type == "pixel")
+            return GL_FRAGMENT_SHADER;
+        
+        GE_CORE_ASSERT(false, "Unknown shader type!");
+        return 0;
+    }
+
+    OpenGLShader::OpenGLShader(const std::string& filepath) {
+        std::string source = ReadFile(filepath);
+        auto shaderSources = PreProcess(source);
+        Compile(shaderSources);
+        
+        // Extract name from filepath
+        auto lastSlash = filepath.find_last_of("/\\");
+        lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+        auto lastDot = filepath.rfind('.');
+        auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+        m_Name = filepath.substr(lastSlash, count);
+    }
+
+    OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+        : m_Name(name) {
+        std::unordered_map<uint32_t, std::string> sources;
+        sources[GL_VERTEX_SHADER] = vertexSrc;
+        sources[GL_FRAGMENT_SHADER] = fragmentSrc;
+        Compile(sources);
+    }
+
+    OpenGLShader::~OpenGLShader() {
+        OpenGLStateCache::OnProgramDeleted(m_RendererID);
+        glDeleteProgram(m_RendererID);
+    }
+
+    std::string OpenGLShader::ReadFile(const std::string& filepath) {
+        std::string result;
+        std::ifstream in(filepath, std::ios::in | std::ios::binary);
+        if (in) {
+            in.seekg(0, std::ios::end);
+            size_t size = in.tellg();
+            if (size != -1) {
+                result.resize(size);
+                in.seekg(0, std::ios::beg);
+                in.read(&result[0], size);
+            } else {
+                GE_CORE_ERROR("Could not read from file '{0}'", filepath);
+            }
+        } else {
+            GE_CORE_ERROR("Could not open file '{0}'", filepath);
+        }
+        
+        return result;
+    }
+
+    std::unordered_map<uint32_t, std::string> OpenGLShader::PreProcess(const std::string& source) {
+        std::unordered_map<uint32_t, std::string> shaderSources;
+        
+        const char* typeToken = "#type";
+        size_t typeTokenLength = strlen(typeToken);
+        size_t pos = source.find(typeToken, 0);
+        while (pos != std::string::npos) {
+            size_t eol = source.find_first_of("\r\n", pos);
+            GE_CORE_ASSERT(eol != std::string::npos, "Syntax error");
+            size_t begin = pos + typeTokenLength + 1;
+            std::string type = source.substr(begin, eol - begin);
+            GE_CORE_ASSERT(ShaderTypeFromString(type), "Invalid shader type specified");
+            
+            size_t nextLinePos = source.find_first_not_of("\r\n", eol);
+            GE_CORE_ASSERT(nextLinePos != std::string::npos, "Syntax error");
+            pos = source.find(typeToken, nextLinePos);
+            
+            shaderSources[ShaderTypeFromString(type)] = (pos == std::string::npos) ? source.substr(nextLinePos) : source.substr(nextLinePos, pos - nextLinePos);
+        }
+        
+        return shaderSources;
+    }
+
+    void OpenGLShader::Compile(const std::unordered_map<uint32_t, std::string>& shaderSources) {
+        uint32_t program = glCreateProgram();
+        GE_CORE_ASSERT(shaderSources.size() <= 2, "We only support 2 shaders for now");
+        std::array<uint32_t, 2> glShaderIDs;
+        int glShaderIDIndex = 0;
+        
+        for (auto& kv : shaderSources) {
+            uint32_t type = kv.first;
+            const std::string& source = kv.second;
+            
+            uint32_t shader = glCreateShader(type);
+            const char* sourceCStr = source.c_str();
+            glShaderSource(shader, 1, &sourceCStr, 0);
+            glCompileShader(shader);
+            
+            int isCompiled = 0;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+            if (isCompiled == GL_FALSE) {
+                int maxLength = 0;
+                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
+                
+                std::vector<char> infoLog(maxLength);
+                glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
+                
+                glDeleteShader(shader);
+                
+                GE_CORE_ERROR("{0}", infoLog.data());
+                GE_CORE_ASSERT(false, "Shader compilation failure!");
+                break;
+            }
+            
+            glAttachShader(program, shader);
+            glShaderIDs[glShaderIDIndex++] = shader;
+        }
+        
+        m_RendererID = program;
+        
+        glLinkProgram(program);
+        
+        int isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
+        if (isLinked == GL_FALSE) {
+            int maxLength = 0;
+            glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
+            
+            std::vector<char> infoLog(maxLength);
+            glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
+            
+            glDeleteProgram(program);
+            
+            for (auto id : glShaderIDs)
+                glDeleteShader(id);
+            
+            GE_CORE_ERROR("{0}", infoLog.data());
+            GE_CORE_ASSERT(false, "Shader link failure!");
+            return;
+        }
+        
+        for (auto id : glShaderIDs) {
+            glDetachShader(program, id);
+            glDeleteShader(id);
+        }
+    }
+
+    void OpenGLShader::Bind() const {
+        OpenGLStateCache::UseProgram(m_RendererID);
+    }
+
+    void OpenGLShader::Unbind() const {
+        OpenGLStateCache::UseProgram(0);
+    }
+
+    void OpenGLShader::SetInt(const std::string& name, int value) {
+        glUniform1i(GetUniformLocation(name), value);
+    }
+
+    void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t count) {
+        glUniform1iv(GetUniformLocation(name), count, values);
+    }
+
+    void OpenGLShader::SetFloat(const std::string& name, float value) {
+        glUniform1f(GetUniformLocation(name), value);
+    }
+
+    void OpenGLShader::SetFloat2(const std::string& name, const glm::vec2& value) {
+        glUniform2f(GetUniformLocation(name), value.x, value.y);
+    }
+
+    void OpenGLShader::SetFloat3(const std::string& name, const glm::vec3& value) {
+        glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
+    }
+
+    void OpenGLShader::SetFloat4(const std::string& name, const glm::vec4& value) {
+        glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
+    }
+
+    void OpenGLShader::SetMat3(const std::string& name, const glm::mat3& value) {
+        glUniformMatrix3fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    }
+
+    void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value) {
+        glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+    }
+
+    int OpenGLShader::GetUniformLocation(const std::string& name) {
+        if (m_UniformLocationCache.find(name) != m_UniformLocationCache.end())
+            return m_UniformLocationCache[name];
+        
+        int location = glGetUniformLocation(m_RendererID, name.c_str());
+        if (location == -1)
+            GE_CORE_WARN("Uniform '{0}' doesn't exist!", name);
+        
+        m_UniformLocationCache[name] = location;
+        return location;
+    }
+
+}
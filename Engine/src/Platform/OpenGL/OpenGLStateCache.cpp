@@ -0,0 +1,180 @@
+#include "OpenGLStateCache.h"
+#include "Engine/Core/Logger.h"
+
+#include <glad/glad.h>
+#include <array>
+
+namespace Engine {
+
+    static const uint32_t s_Unknown = 0xFFFFFFFFu;
+
+    struct OpenGLState {
+        uint32_t Program = s_Unknown;
+        uint32_t VertexArray = s_Unknown;
+        uint32_t ArrayBuffer = s_Unknown;
+        uint32_t ActiveUnit = s_Unknown;
+        std::array<uint32_t, OpenGLStateCache::MaxTextureUnits> Textures;
+        std::array<uint32_t, OpenGLStateCache::MaxTextureUnits> TextureArrays;
+        uint32_t Blend = s_Unknown;
+        uint32_t BlendSource = s_Unknown, BlendDestination = s_Unknown;
+        uint32_t DepthTest = s_Unknown;
+        uint32_t DepthWrite = s_Unknown;
+        uint32_t DepthFunc = s_Unknown;
+
+        OpenGLState() {
+            Textures.fill(s_Unknown);
+            TextureArrays.fill(s_Unknown);
+        }
+    };
+
+    static OpenGLState s_State;
+    static RendererAPI::StateChangeStats s_Stats;
+
+    // Records the new value and returns whether the GL call has to be made
+    static bool Change(uint32_t& current, uint32_t value) {
+        if (current == value) {
+            s_Stats.Redundant++;
+            return false;
+        }
+
+        current = value;
+        s_Stats.Issued++;
+        return true;
+    }
+
+    void OpenGLStateCache::Invalidate() {
+        s_State = OpenGLState();
+    }
+
+    void OpenGLStateCache::UseProgram(uint32_t program) {
+        if (Change(s_State.Program, program))
+            glUseProgram(program);
+    }
+
+    void OpenGLStateCache::BindVertexArray(uint32_t vertexArray) {
+        if (Change(s_State.VertexArray, vertexArray))
+            glBindVertexArray(vertexArray);
+    }
+
+    void OpenGLStateCache::BindArrayBuffer(uint32_t buffer) {
+        if (Change(s_State.ArrayBuffer, buffer))
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    }
+
+    // Each unit has a separate binding per target
+    static void BindTextureTarget(uint32_t unit, uint32_t texture, uint32_t target,
+                                  std::array<uint32_t, OpenGLStateCache::MaxTextureUnits>& bindings) {
+        GE_CORE_ASSERT(unit < OpenGLStateCache::MaxTextureUnits, "Texture unit out of range!");
+
+        // Skip the unit switch too when the texture is already there
+        if (bindings[unit] == texture) {
+            s_Stats.Redundant++;
+            return;
+        }
+
+        if (Change(s_State.ActiveUnit, unit))
+            glActiveTexture(GL_TEXTURE0 + unit);
+        if (Change(bindings[unit], texture))
+            glBindTexture(target, texture);
+    }
+
+    // Binds on the active unit, or unit 0 if that isn't known yet
+    static void BindTextureTargetForUpload(uint32_t texture, uint32_t target,
+                                           std::array<uint32_t, OpenGLStateCache::MaxTextureUnits>& bindings) {
+        if (s_State.ActiveUnit == s_Unknown || s_State.ActiveUnit >= OpenGLStateCache::MaxTextureUnits) {
+            BindTextureTarget(0, texture, target, bindings);
+            return;
+        }
+
+        if (Change(bindings[s_State.ActiveUnit], texture))
+            glBindTexture(target, texture);
+    }
+
+    void OpenGLStateCache::BindTexture(uint32_t unit, uint32_t texture) {
+        BindTextureTarget(unit, texture, GL_TEXTURE_2D, s_State.Textures);
+    }
+
+    void OpenGLStateCache::BindTextureForUpload(uint32_t texture) {
+        BindTextureTargetForUpload(texture, GL_TEXTURE_2D, s_State.Textures);
+    }
+
+    void OpenGLStateCache::BindTextureArray(uint32_t unit, uint32_t texture) {
+        BindTextureTarget(unit, texture, GL_TEXTURE_2D_ARRAY, s_State.TextureArrays);
+    }
+
+    void OpenGLStateCache::BindTextureArrayForUpload(uint32_t texture) {
+        BindTextureTargetForUpload(texture, GL_TEXTURE_2D_ARRAY, s_State.TextureArrays);
+    }
+
+    void OpenGLStateCache::SetBlend(bool enabled) {
+        if (Change(s_State.Blend, enabled ? 1 : 0)) {
+            if (enabled)
+                glEnable(GL_BLEND);
+            else
+                glDisable(GL_BLEND);
+        }
+    }
+
+    void OpenGLStateCache::SetBlendFunc(uint32_t source, uint32_t destination) {
+        if (s_State.BlendSource == source && s_State.BlendDestination == destination) {
+            s_Stats.Redundant++;
+            return;
+        }
+
+        s_State.BlendSource = source;
+        s_State.BlendDestination = destination;
+        s_Stats.Issued++;
+        glBlendFunc(source, destination);
+    }
+
+    void OpenGLStateCache::SetDepthTest(bool enabled) {
+        if (Change(s_State.DepthTest, enabled ? 1 : 0)) {
+            if (enabled)
+                glEnable(GL_DEPTH_TEST);
+            else
+                glDisable(GL_DEPTH_TEST);
+        }
+    }
+
+    void OpenGLStateCache::SetDepthWrite(bool enabled) {
+        if (Change(s_State.DepthWrite, enabled ? 1 : 0))
+            glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+
+    void OpenGLStateCache::SetDepthFunc(uint32_t func) {
+        if (Change(s_State.DepthFunc, func))
+            glDepthFunc(func);
+    }
+
+    void OpenGLStateCache::OnProgramDeleted(uint32_t program) {
+        // Deleting the current program only flags it; it stays in use until replaced
+        if (s_State.Program == program)
+            s_State.Program = s_Unknown;
+    }
+
+    void OpenGLStateCache::OnVertexArrayDeleted(uint32_t vertexArray) {
+        if (s_State.VertexArray == vertexArray)
+            s_State.VertexArray = 0;
+    }
+
+    void OpenGLStateCache::OnBufferDeleted(uint32_t buffer) {
+        if (s_State.ArrayBuffer == buffer)
+            s_State.ArrayBuffer = 0;
+    }
+
+    void OpenGLStateCache::OnTextureDeleted(uint32_t texture) {
+        for (uint32_t& bound : s_State.Textures) {
+            if (bound == texture)
+                bound = 0;
+        }
+        for (uint32_t& bound : s_State.TextureArrays) {
+            if (bound == texture)
+                bound = 0;
+        }
+    }
+
+    RendererAPI::StateChangeStats& OpenGLStateCache::GetStats() {
+        return s_Stats;
+    }
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Engine/Renderer/RendererAPI.h"
+
+namespace Engine {
+
+    // Shadow copy of the GL bindings the engine touches: program, vertex array, array
+    // buffer, per-unit 2D and array textures and blend/depth state. Calls that would
+    // not change the current value are dropped and counted as redundant. All OpenGL
+    // code binds through here so the shadow stays accurate; deleting an object must be
+    // reported because GL unbinds it implicitly and may hand its name out again.
+    // GL_ELEMENT_ARRAY_BUFFER is vertex array state and is left to the callers.
+    class OpenGLStateCache {
+    public:
+        static const uint32_t MaxTextureUnits = 32;
+
+        // Forget everything, e.g. after code outside the engine changed GL state
+        static void Invalidate();
+
+        static void UseProgram(uint32_t program);
+        static void BindVertexArray(uint32_t vertexArray);
+        static void BindArrayBuffer(uint32_t buffer);
+        static void BindTexture(uint32_t unit, uint32_t texture);
+        // Binds on whichever unit is active, for uploads that don't care about the unit
+        static void BindTextureForUpload(uint32_t texture);
+        static void BindTextureArray(uint32_t unit, uint32_t texture);
+        static void BindTextureArrayForUpload(uint32_t texture);
+
+        static void SetBlend(bool enabled);
+        static void SetBlendFunc(uint32_t source, uint32_t destination);
+        static void SetDepthTest(bool enabled);
+        static void SetDepthWrite(bool enabled);
+        static void SetDepthFunc(uint32_t func);
+
+        static void OnProgramDeleted(uint32_t program);
+        static void OnVertexArrayDeleted(uint32_t vertexArray);
+        static void OnBufferDeleted(uint32_t buffer);
+        static void OnTextureDeleted(uint32_t texture);
+
+        static RendererAPI::StateChangeStats& GetStats();
+    };
+
+}
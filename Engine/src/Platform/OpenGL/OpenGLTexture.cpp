@@ -1,8 +1,11 @@
 #include "OpenGLTexture.h"
+#include "OpenGLStateCache.h"
+#include "Engine/Renderer/CompressedImage.h"
 #include "Engine/Core/Logger.h"
 
 #include <glad/glad.h>
 #include <stb_image.h>
+#include <cmath>
 
 namespace Engine {
 
@@ -12,7 +15,7 @@ namespace Engine {
         m_DataFormat = GL_RGBA;
         
         glGenTextures(1, &m_RendererID);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
         
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -24,8 +27,13 @@ namespace Engine {
         m_IsLoaded = true;
     }
 
-    OpenGLTexture2D::OpenGLTexture2D(const std::string& path)
+    OpenGLTexture2D::OpenGLTexture2D(const std::string& path, const TextureSpecification& specification)
         : m_Path(path) {
+        if (CompressedImage::IsCompressedPath(path)) {
+            LoadCompressed(specification);
+            return;
+        }
+        
         int width, height, channels;
         stbi_set_flip_vertically_on_load(1);
         stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
@@ -39,9 +47,11 @@ namespace Engine {
             if (channels == 4) {
                 internalFormat = GL_RGBA8;
                 dataFormat = GL_RGBA;
+                m_Format = ImageFormat::RGBA8;
             } else if (channels == 3) {
                 internalFormat = GL_RGB8;
                 dataFormat = GL_RGB;
+                m_Format = ImageFormat::RGB8;
             }
             
             m_InternalFormat = internalFormat;
@@ -50,44 +60,188 @@ namespace Engine {
             GE_CORE_ASSERT(internalFormat & dataFormat, "Format not supported!");
             
             glGenTextures(1, &m_RendererID);
-            glBindTexture(GL_TEXTURE_2D, m_RendererID);
-            
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            OpenGLStateCache::BindTextureForUpload(m_RendererID);
             
             glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_Width, m_Height, 0, dataFormat, GL_UNSIGNED_BYTE, data);
             
+            if (specification.GenerateMips) {
+                m_MipCount = 1 + (uint32_t)std::floor(std::log2((float)std::max(m_Width, m_Height)));
+                glGenerateMipmap(GL_TEXTURE_2D);
+            }
+            
+            ApplySampling(specification);
+            
             stbi_image_free(data);
         } else {
             GE_CORE_ERROR("Failed to load texture: {0}", path);
         }
     }
 
+    void OpenGLTexture2D::LoadCompressed(const TextureSpecification& specification) {
+        CompressedImage image;
+        if (!CompressedImage::LoadDDS(m_Path, image))
+            return;
+        
+        uint32_t internalFormat = 0;
+        switch (image.Format) {
+            case ImageFormat::BC1:
+                if (GLAD_GL_EXT_texture_compression_s3tc)
+                    internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+                break;
+            case ImageFormat::BC3:
+                if (GLAD_GL_EXT_texture_compression_s3tc)
+                    internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+                break;
+            case ImageFormat::BC7:
+                if (GLAD_GL_ARB_texture_compression_bptc)
+                    internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+                break;
+            default:
+                break;
+        }
+        
+        if (!internalFormat) {
+            GE_CORE_ERROR("{0} textures are not supported by this GPU: {1}", ImageFormatToString(image.Format), m_Path);
+            return;
+        }
+        
+        m_Width = image.Width;
+        m_Height = image.Height;
+        m_Format = image.Format;
+        m_MipCount = (uint32_t)image.Levels.size();
+        m_InternalFormat = internalFormat;
+        
+        glGenTextures(1, &m_RendererID);
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
+        
+        for (uint32_t level = 0; level < m_MipCount; level++) {
+            const CompressedImage::Level& mip = image.Levels[level];
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, mip.Width, mip.Height, 0,
+                                   (GLsizei)mip.Size, image.Data.data() + mip.Offset);
+        }
+        
+        // A partial chain would leave the texture incomplete
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_MipCount - 1);
+        
+        ApplySampling(specification);
+        m_IsLoaded = true;
+    }
+
+    void OpenGLTexture2D::ApplySampling(const TextureSpecification& specification) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        
+        // Extension on a 3.3 context; the ARB and EXT versions share their enums
+        bool anisotropy = GLAD_GL_ARB_texture_filter_anisotropic || GLAD_GL_EXT_texture_filter_anisotropic;
+        if (specification.MaxAnisotropy > 1.0f && anisotropy) {
+            float limit = 1.0f;
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &limit);
+            glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, std::min(specification.MaxAnisotropy, limit));
+        }
+    }
+
     OpenGLTexture2D::~OpenGLTexture2D() {
+        OpenGLStateCache::OnTextureDeleted(m_RendererID);
         glDeleteTextures(1, &m_RendererID);
     }
 
     void OpenGLTexture2D::SetData(void* data, uint32_t size) {
+        GE_CORE_ASSERT(m_Format == ImageFormat::RGBA8 || m_Format == ImageFormat::RGB8, "Cannot set data of a compressed texture!");
         uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
         GE_CORE_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
         glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        if (m_MipCount > 1)
+            glGenerateMipmap(GL_TEXTURE_2D);
+    }
+
+    void OpenGLTexture2D::SetSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        GE_CORE_ASSERT(m_Format == ImageFormat::RGBA8 || m_Format == ImageFormat::RGB8, "Cannot set data of a compressed texture!");
+        GE_CORE_ASSERT(x + width <= m_Width && y + height <= m_Height, "Sub-region exceeds texture bounds!");
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        if (m_MipCount > 1)
+            glGenerateMipmap(GL_TEXTURE_2D);
     }
 
     void OpenGLTexture2D::Bind(uint32_t slot) const {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_RendererID);
+        OpenGLStateCache::BindTexture(slot, m_RendererID);
     }
 
-    Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
-        return CreateRef<OpenGLTexture2D>(width, height);
+    void OpenGLTexture2D::MarkPending(const std::string& path) {
+        m_Path = path;
+        m_IsLoaded = false;
+        m_IsReady = false;
     }
 
-    Ref<Texture2D> Texture2D::Create(const std::string& path) {
-        return CreateRef<OpenGLTexture2D>(path);
+    void OpenGLTexture2D::AllocateStorage(uint32_t width, uint32_t height, uint32_t channels) {
+        m_Width = width;
+        m_Height = height;
+        if (channels == 3) {
+            m_InternalFormat = GL_RGB8;
+            m_DataFormat = GL_RGB;
+            m_Format = ImageFormat::RGB8;
+        } else {
+            m_InternalFormat = GL_RGBA8;
+            m_DataFormat = GL_RGBA;
+            m_Format = ImageFormat::RGBA8;
+        }
+        
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
+        glTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, m_DataFormat, GL_UNSIGNED_BYTE, nullptr);
     }
 
-}
+    void OpenGLTexture2D::ApplySpecification(const TextureSpecification& specification) {
+        OpenGLStateCache::BindTextureForUpload(m_RendererID);
+        
+        m_MipCount = 1;
+        if (specification.GenerateMips) {
+            m_MipCount = 1 + (uint32_t)std::floor(std::log2((float)std::max(m_Width, m_Height)));
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
+        
+        ApplySampling(specification);
+    }
 
+    void OpenGLTexture2D::MarkReady(bool loaded) {
+        m_IsLoaded = loaded;
+        m_IsReady = true;
+    }
+
+    OpenGLTexture2DArray::OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers)
+        : m_Width(width), m_Height(height), m_LayerCount(layers) {
+        GE_CORE_ASSERT(layers > 0 && layers <= MaxLayers, "Texture array layer count out of range!");
+        
+        glGenTextures(1, &m_RendererID);
+        OpenGLStateCache::BindTextureArrayForUpload(m_RendererID);
+        
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, m_Width, m_Height, m_LayerCount, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    }
+
+    OpenGLTexture2DArray::~OpenGLTexture2DArray() {
+        OpenGLStateCache::OnTextureDeleted(m_RendererID);
+        glDeleteTextures(1, &m_RendererID);
+    }
+
+    void OpenGLTexture2DArray::SetLayerData(uint32_t layer, const void* data) {
+        GE_CORE_ASSERT(layer < m_LayerCount, "Texture array layer out of range!");
+        OpenGLStateCache::BindTextureArrayForUpload(m_RendererID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, m_Width, m_Height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    void OpenGLTexture2DArray::Bind(uint32_t slot) const {
+        OpenGLStateCache::BindTextureArray(slot, m_RendererID);
+    }
+
+}
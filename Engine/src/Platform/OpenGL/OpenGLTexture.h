@@ -7,29 +7,66 @@ namespace Engine {
     class OpenGLTexture2D : public Texture2D {
     public:
         OpenGLTexture2D(uint32_t width, uint32_t height);
-        OpenGLTexture2D(const std::string& path);
+        OpenGLTexture2D(const std::string& path, const TextureSpecification& specification = TextureSpecification());
         virtual ~OpenGLTexture2D();
         
         virtual uint32_t GetWidth() const override { return m_Width; }
         virtual uint32_t GetHeight() const override { return m_Height; }
         virtual uint32_t GetRendererID() const override { return m_RendererID; }
+        virtual ImageFormat GetFormat() const override { return m_Format; }
+        virtual uint32_t GetMipCount() const override { return m_MipCount; }
+        virtual uint64_t GetMemorySize() const override { return GetImageFormatSize(m_Format, m_Width, m_Height, m_MipCount); }
         
         virtual void SetData(void* data, uint32_t size) override;
+        virtual void SetSubData(void* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
         virtual void Bind(uint32_t slot = 0) const override;
         
         virtual bool IsLoaded() const override { return m_IsLoaded; }
+        virtual bool IsReady() const override { return m_IsReady; }
         
         virtual bool operator==(const Texture& other) const override {
             return m_RendererID == other.GetRendererID();
         }
         
+        // Async loading, driven by OpenGLTextureUploader
+        void MarkPending(const std::string& path);
+        // Reallocates RGB8 (3 channels) or RGBA8 storage; contents are undefined until uploaded
+        void AllocateStorage(uint32_t width, uint32_t height, uint32_t channels);
+        // Builds the mip chain if requested and sets sampling, once level 0 is uploaded
+        void ApplySpecification(const TextureSpecification& specification);
+        void MarkReady(bool loaded);
+        
+    private:
+        void LoadCompressed(const TextureSpecification& specification);
+        void ApplySampling(const TextureSpecification& specification);
+        
     private:
         std::string m_Path;
         bool m_IsLoaded = false;
-        uint32_t m_Width, m_Height;
+        bool m_IsReady = true;
+        uint32_t m_Width = 0, m_Height = 0;
+        uint32_t m_RendererID = 0;
+        uint32_t m_InternalFormat = 0, m_DataFormat = 0;
+        ImageFormat m_Format = ImageFormat::RGBA8;
+        uint32_t m_MipCount = 1;
+    };
+
+    class OpenGLTexture2DArray : public Texture2DArray {
+    public:
+        OpenGLTexture2DArray(uint32_t width, uint32_t height, uint32_t layers);
+        virtual ~OpenGLTexture2DArray();
+        
+        virtual uint32_t GetWidth() const override { return m_Width; }
+        virtual uint32_t GetHeight() const override { return m_Height; }
+        virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+        virtual uint32_t GetRendererID() const override { return m_RendererID; }
+        
+        virtual void SetLayerData(uint32_t layer, const void* data) override;
+        virtual void Bind(uint32_t slot = 0) const override;
+        
+    private:
+        uint32_t m_Width, m_Height, m_LayerCount;
         uint32_t m_RendererID;
-        uint32_t m_InternalFormat, m_DataFormat;
     };
 
 }
-
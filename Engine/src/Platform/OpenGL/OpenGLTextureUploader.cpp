@@ -0,0 +1,109 @@
+#include "OpenGLTextureUploader.h"
+#include "OpenGLTexture.h"
+#include "OpenGLStateCache.h"
+
+#include <glad/glad.h>
+#include <cstring>
+
+namespace Engine {
+
+    OpenGLTextureUploader::OpenGLTextureUploader(uint32_t stagingSize)
+        : m_BufferSize(stagingSize) {
+        for (PixelBuffer& buffer : m_Buffers) {
+            glGenBuffers(1, &buffer.RendererID);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.RendererID);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, m_BufferSize, nullptr, GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    OpenGLTextureUploader::~OpenGLTextureUploader() {
+        for (PixelBuffer& buffer : m_Buffers) {
+            if (buffer.Fence)
+                glDeleteSync((GLsync)buffer.Fence);
+            OpenGLStateCache::OnBufferDeleted(buffer.RendererID);
+            glDeleteBuffers(1, &buffer.RendererID);
+        }
+    }
+
+    Ref<Texture2D> OpenGLTextureUploader::CreatePlaceholder(const std::string& path) {
+        Ref<OpenGLTexture2D> texture = CreateRef<OpenGLTexture2D>(1, 1);
+        uint32_t transparent = 0;
+        texture->SetData(&transparent, sizeof(uint32_t));
+        texture->MarkPending(path);
+        return texture;
+    }
+
+    void OpenGLTextureUploader::BeginFrame() {
+        // Fence the buffer last frame wrote to and move on to the next one
+        if (m_Offset > 0) {
+            m_Buffers[m_Current].Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            m_Current = (m_Current + 1) % PixelBufferCount;
+            m_Offset = 0;
+        }
+
+        PixelBuffer& buffer = m_Buffers[m_Current];
+        if (buffer.Fence) {
+            GLenum status = glClientWaitSync((GLsync)buffer.Fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+                m_Writable = false;
+                return;
+            }
+            glDeleteSync((GLsync)buffer.Fence);
+            buffer.Fence = nullptr;
+        }
+        m_Writable = true;
+    }
+
+    bool OpenGLTextureUploader::Upload(const Ref<Texture2D>& texture, const void* pixels, uint32_t width, uint32_t height,
+                                       uint32_t channels, const TextureSpecification& specification) {
+        OpenGLTexture2D& target = static_cast<OpenGLTexture2D&>(*texture);
+        const uint32_t size = width * height * channels;
+        const GLenum dataFormat = channels == 3 ? GL_RGB : GL_RGBA;
+
+        if (size > m_BufferSize) {
+            target.AllocateStorage(width, height, channels);
+            // RGB rows are tightly packed, not padded to 4 bytes
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, pixels);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            target.ApplySpecification(specification);
+            target.MarkReady(true);
+            return true;
+        }
+
+        if (!m_Writable || m_Offset + size > m_BufferSize)
+            return false;
+
+        // Allocate before binding the unpack buffer, or the null data pointer would be read
+        // as an offset into it
+        target.AllocateStorage(width, height, channels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_Buffers[m_Current].RendererID);
+        void* staging = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, m_Offset, size,
+                                         GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (staging) {
+            memcpy(staging, pixels, size);
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, (const void*)(uintptr_t)m_Offset);
+            m_Offset += size;
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        // Mapping failed, fall back to a direct upload
+        if (!staging)
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        // Queued behind the transfer, so the mips are built from the uploaded level
+        target.ApplySpecification(specification);
+        target.MarkReady(true);
+        return true;
+    }
+
+    void OpenGLTextureUploader::Fail(const Ref<Texture2D>& texture) {
+        static_cast<OpenGLTexture2D&>(*texture).MarkReady(false);
+    }
+
+}
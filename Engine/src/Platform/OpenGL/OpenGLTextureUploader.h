@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Engine/Renderer/TextureUploadQueue.h"
+#include <array>
+
+namespace Engine {
+
+    // Streams pixels through a ring of pixel unpack buffers, one per frame. The copy
+    // into GL memory is a memcpy on the render thread; the transfer into the texture
+    // then runs asynchronously. A buffer is reused only once its fence has signalled,
+    // otherwise uploads wait a frame. Images larger than one buffer are uploaded
+    // straight from client memory.
+    class OpenGLTextureUploader : public TextureUploader {
+    public:
+        OpenGLTextureUploader(uint32_t stagingSize);
+        virtual ~OpenGLTextureUploader();
+
+        virtual Ref<Texture2D> CreatePlaceholder(const std::string& path) override;
+
+        virtual void BeginFrame() override;
+        virtual bool Upload(const Ref<Texture2D>& texture, const void* pixels, uint32_t width, uint32_t height,
+                            uint32_t channels, const TextureSpecification& specification) override;
+        virtual void Fail(const Ref<Texture2D>& texture) override;
+
+    private:
+        static const uint32_t PixelBufferCount = 3;
+
+        struct PixelBuffer {
+            uint32_t RendererID = 0;
+            void* Fence = nullptr; // GLsync for the last frame that wrote to it
+        };
+
+        std::array<PixelBuffer, PixelBufferCount> m_Buffers;
+        uint32_t m_BufferSize;
+        uint32_t m_Current = 0;
+        uint32_t m_Offset = 0;      // Bytes written to the current buffer this frame
+        bool m_Writable = false;    // Current buffer's previous transfers have finished
+    };
+
+}
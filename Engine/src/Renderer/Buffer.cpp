@@ -0,0 +1,63 @@
+#include "Engine/Renderer/Buffer.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "../Platform/OpenGL/OpenGLBuffer.h"
+#include "../Platform/Null/NullBuffer.h"
+
+namespace Engine {
+
+    Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size);
+            case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(size);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size);
+            case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(vertices, size);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<StreamingVertexBuffer> StreamingVertexBuffer::Create(uint32_t regionSize, uint32_t regionCount) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLStreamingVertexBuffer>(regionSize, regionCount);
+            case RendererAPI::API::Null:    return CreateRef<NullStreamingVertexBuffer>(regionSize, regionCount);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, count);
+            case RendererAPI::API::Null:    return CreateRef<NullIndexBuffer>(indices, count);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<VertexArray> VertexArray::Create() {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+            case RendererAPI::API::Null:    return CreateRef<NullVertexArray>();
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
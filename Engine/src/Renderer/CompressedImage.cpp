@@ -0,0 +1,134 @@
+#include "Engine/Renderer/CompressedImage.h"
+#include "Engine/Core/Logger.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace Engine {
+
+    // Layout of the DDS header, see the DirectX "DDS_HEADER" documentation
+    struct DDSPixelFormat {
+        uint32_t Size;
+        uint32_t Flags;
+        uint32_t FourCC;
+        uint32_t RGBBitCount;
+        uint32_t RBitMask, GBitMask, BBitMask, ABitMask;
+    };
+
+    struct DDSHeader {
+        uint32_t Size;
+        uint32_t Flags;
+        uint32_t Height;
+        uint32_t Width;
+        uint32_t PitchOrLinearSize;
+        uint32_t Depth;
+        uint32_t MipMapCount;
+        uint32_t Reserved1[11];
+        DDSPixelFormat PixelFormat;
+        uint32_t Caps, Caps2, Caps3, Caps4;
+        uint32_t Reserved2;
+    };
+
+    struct DDSHeaderDX10 {
+        uint32_t DXGIFormat;
+        uint32_t ResourceDimension;
+        uint32_t MiscFlag;
+        uint32_t ArraySize;
+        uint32_t MiscFlags2;
+    };
+
+    static_assert(sizeof(DDSHeader) == 124, "DDS header must be 124 bytes");
+
+    static constexpr uint32_t MakeFourCC(char a, char b, char c, char d) {
+        return (uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24);
+    }
+
+    static const uint32_t DDSMagic = MakeFourCC('D', 'D', 'S', ' ');
+    static const uint32_t DDSFlagMipMapCount = 0x20000;
+    static const uint32_t DDSPixelFormatFourCC = 0x4;
+
+    static ImageFormat DXGIToImageFormat(uint32_t dxgiFormat) {
+        switch (dxgiFormat) {
+            case 71: case 72:   return ImageFormat::BC1;    // DXGI_FORMAT_BC1_UNORM(_SRGB)
+            case 77: case 78:   return ImageFormat::BC3;    // DXGI_FORMAT_BC3_UNORM(_SRGB)
+            case 98: case 99:   return ImageFormat::BC7;    // DXGI_FORMAT_BC7_UNORM(_SRGB)
+        }
+        return ImageFormat::None;
+    }
+
+    bool CompressedImage::IsCompressedPath(const std::string& path) {
+        if (path.size() < 4)
+            return false;
+        
+        std::string extension = path.substr(path.size() - 4);
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+        return extension == ".dds";
+    }
+
+    bool CompressedImage::LoadDDS(const std::string& path, CompressedImage& outImage) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            GE_CORE_ERROR("Failed to open compressed texture: {0}", path);
+            return false;
+        }
+        
+        std::streamsize fileSize = file.tellg();
+        file.seekg(0);
+        
+        uint32_t magic = 0;
+        DDSHeader header;
+        file.read((char*)&magic, sizeof(magic));
+        file.read((char*)&header, sizeof(header));
+        if (!file || magic != DDSMagic || header.Size != sizeof(DDSHeader)) {
+            GE_CORE_ERROR("Not a DDS file: {0}", path);
+            return false;
+        }
+        
+        ImageFormat format = ImageFormat::None;
+        if (header.PixelFormat.Flags & DDSPixelFormatFourCC) {
+            uint32_t fourCC = header.PixelFormat.FourCC;
+            if (fourCC == MakeFourCC('D', 'X', 'T', '1')) {
+                format = ImageFormat::BC1;
+            } else if (fourCC == MakeFourCC('D', 'X', 'T', '5')) {
+                format = ImageFormat::BC3;
+            } else if (fourCC == MakeFourCC('D', 'X', '1', '0')) {
+                DDSHeaderDX10 dx10;
+                file.read((char*)&dx10, sizeof(dx10));
+                if (file && dx10.ArraySize <= 1)
+                    format = DXGIToImageFormat(dx10.DXGIFormat);
+            }
+        }
+        
+        if (format == ImageFormat::None) {
+            GE_CORE_ERROR("Unsupported DDS format in {0}, expected BC1, BC3 or BC7", path);
+            return false;
+        }
+        
+        uint32_t mipCount = (header.Flags & DDSFlagMipMapCount) ? std::max(header.MipMapCount, 1u) : 1;
+        
+        outImage.Format = format;
+        outImage.Width = header.Width;
+        outImage.Height = header.Height;
+        outImage.Levels.clear();
+        
+        uint64_t offset = 0;
+        for (uint32_t level = 0; level < mipCount; level++) {
+            uint32_t width = std::max(header.Width >> level, 1u);
+            uint32_t height = std::max(header.Height >> level, 1u);
+            uint64_t size = GetImageFormatSize(format, width, height);
+            outImage.Levels.push_back({ width, height, offset, size });
+            offset += size;
+        }
+        
+        std::streamsize dataStart = file.tellg();
+        if ((uint64_t)(fileSize - dataStart) < offset) {
+            GE_CORE_ERROR("DDS file is truncated: {0}", path);
+            return false;
+        }
+        
+        outImage.Data.resize(offset);
+        file.read((char*)outImage.Data.data(), offset);
+        return true;
+    }
+
+}
@@ -0,0 +1,168 @@
+#include "Engine/Renderer/Font.h"
+#include "Engine/Core/Logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace Engine {
+
+    // Value of key=value on a BMFont line, quotes stripped; empty if the key is missing
+    static std::string ReadField(const std::string& line, const char* key) {
+        const std::string pattern = std::string(" ") + key + "=";
+        size_t start = line.find(pattern);
+        if (start == std::string::npos)
+            return {};
+
+        start += pattern.size();
+        if (start < line.size() && line[start] == '"') {
+            size_t end = line.find('"', start + 1);
+            return line.substr(start + 1, end == std::string::npos ? std::string::npos : end - start - 1);
+        }
+
+        size_t end = line.find(' ', start);
+        return line.substr(start, end == std::string::npos ? std::string::npos : end - start);
+    }
+
+    static int ReadInt(const std::string& line, const char* key) {
+        std::string value = ReadField(line, key);
+        return value.empty() ? 0 : std::atoi(value.c_str());
+    }
+
+    // Decodes one UTF-8 sequence at text[i] and advances i; malformed bytes decode as U+FFFD
+    static uint32_t NextCodepoint(const std::string& text, size_t& i) {
+        const uint8_t lead = (uint8_t)text[i++];
+        if (lead < 0x80)
+            return lead;
+
+        uint32_t length = (lead & 0xE0) == 0xC0 ? 1 : (lead & 0xF0) == 0xE0 ? 2 : (lead & 0xF8) == 0xF0 ? 3 : 0;
+        if (length == 0 || i + length > text.size())
+            return 0xFFFD;
+
+        uint32_t codepoint = lead & (0x3F >> length);
+        for (uint32_t j = 0; j < length; j++) {
+            const uint8_t next = (uint8_t)text[i];
+            if ((next & 0xC0) != 0x80)
+                return 0xFFFD;
+            codepoint = (codepoint << 6) | (next & 0x3F);
+            i++;
+        }
+        return codepoint;
+    }
+
+    Font::Font(const std::string& filepath)
+        : m_Filepath(filepath)
+    {
+        if (!LoadBMFont(filepath)) {
+            GE_CORE_ERROR("Failed to load font: {0}", filepath);
+            m_Atlas = nullptr;
+        }
+    }
+
+    Ref<Font> Font::Create(const std::string& filepath) {
+        return CreateRef<Font>(filepath);
+    }
+
+    bool Font::LoadBMFont(const std::string& filepath) {
+        std::ifstream file(filepath);
+        if (!file.is_open())
+            return false;
+
+        float scaleW = 0.0f, scaleH = 0.0f;
+        std::string line;
+        while (std::getline(file, line)) {
+            std::istringstream stream(line);
+            std::string tag;
+            stream >> tag;
+
+            if (tag == "common") {
+                m_LineHeight = (float)ReadInt(line, "lineHeight");
+                m_Base = (float)ReadInt(line, "base");
+                scaleW = (float)ReadInt(line, "scaleW");
+                scaleH = (float)ReadInt(line, "scaleH");
+                if (ReadInt(line, "pages") > 1)
+                    GE_CORE_WARN("Font {0} has several pages, only page 0 is used", filepath);
+            } else if (tag == "page" && ReadInt(line, "id") == 0) {
+                std::filesystem::path page = std::filesystem::path(filepath).parent_path() / ReadField(line, "file");
+                m_Atlas = Texture2D::Create(page.string());
+            } else if (tag == "char") {
+                if (ReadInt(line, "page") != 0 || scaleW <= 0.0f || scaleH <= 0.0f)
+                    continue;
+
+                const float x = (float)ReadInt(line, "x");
+                const float y = (float)ReadInt(line, "y");
+                const float width = (float)ReadInt(line, "width");
+                const float height = (float)ReadInt(line, "height");
+
+                // BMFont measures down from the top; the page is flipped on load, so v runs up
+                Glyph glyph;
+                glyph.TexMin = { x / scaleW, 1.0f - (y + height) / scaleH };
+                glyph.TexMax = { (x + width) / scaleW, 1.0f - y / scaleH };
+                glyph.Offset = { (float)ReadInt(line, "xoffset"), m_Base - ReadInt(line, "yoffset") - height };
+                glyph.Size = { width, height };
+                glyph.Advance = (float)ReadInt(line, "xadvance");
+                m_Glyphs[(uint32_t)ReadInt(line, "id")] = glyph;
+            } else if (tag == "kerning") {
+                const uint64_t key = ((uint64_t)ReadInt(line, "first") << 32) | (uint32_t)ReadInt(line, "second");
+                m_Kerning[key] = (float)ReadInt(line, "amount");
+            }
+        }
+
+        if (!m_Atlas || !m_Atlas->IsLoaded() || m_LineHeight <= 0.0f)
+            return false;
+
+        GE_CORE_INFO("Loaded font: {0} ({1} glyphs)", filepath, m_Glyphs.size());
+        return true;
+    }
+
+    const Font::Glyph* Font::GetGlyph(uint32_t codepoint) const {
+        auto it = m_Glyphs.find(codepoint);
+        return it != m_Glyphs.end() ? &it->second : nullptr;
+    }
+
+    float Font::GetKerning(uint32_t first, uint32_t second) const {
+        auto it = m_Kerning.find(((uint64_t)first << 32) | second);
+        return it != m_Kerning.end() ? it->second : 0.0f;
+    }
+
+    void Font::Layout(const std::string& text, std::vector<GlyphQuad>& outQuads) const {
+        if (!IsLoaded())
+            return;
+
+        const float scale = 1.0f / m_LineHeight;
+        const Glyph* fallback = GetGlyph('?');
+
+        glm::vec2 pen = { 0.0f, 0.0f };
+        uint32_t previous = 0;
+        for (size_t i = 0; i < text.size();) {
+            const uint32_t codepoint = NextCodepoint(text, i);
+            if (codepoint == '\n') {
+                pen = { 0.0f, pen.y - m_LineHeight };
+                previous = 0;
+                continue;
+            }
+
+            const Glyph* glyph = GetGlyph(codepoint);
+            if (!glyph)
+                glyph = fallback;
+            if (!glyph)
+                continue;
+
+            if (previous)
+                pen.x += GetKerning(previous, codepoint);
+            previous = codepoint;
+
+            if (glyph->Size.x > 0.0f && glyph->Size.y > 0.0f) {
+                GlyphQuad quad;
+                quad.Min = (pen + glyph->Offset) * scale;
+                quad.Max = quad.Min + glyph->Size * scale;
+                quad.TexMin = glyph->TexMin;
+                quad.TexMax = glyph->TexMax;
+                outQuads.push_back(quad);
+            }
+
+            pen.x += glyph->Advance;
+        }
+    }
+
+}
@@ -1,45 +1,105 @@
 #include "Engine/Renderer/Framebuffer.h"
+#include "Engine/Renderer/RendererAPI.h"
 #include "Engine/Core/Logger.h"
+#include "../Platform/Null/NullFramebuffer.h"
+#include "../Platform/OpenGL/OpenGLStateCache.h"
 #include <glad/glad.h>
 
 namespace Engine {
 
+    static bool IsDepthFormat(FramebufferTextureFormat format) {
+        return format == FramebufferTextureFormat::Depth24Stencil8;
+    }
+
     class OpenGLFramebuffer : public Framebuffer {
     public:
         OpenGLFramebuffer(const FramebufferSpecification& spec)
-            : m_Specification(spec) {
+            : m_Specification(spec), m_CapacityWidth(spec.Width), m_CapacityHeight(spec.Height) {
+            for (const FramebufferTextureSpecification& attachment : m_Specification.Attachments.Attachments) {
+                if (IsDepthFormat(attachment.TextureFormat))
+                    m_DepthAttachmentSpecification = attachment;
+                else
+                    m_ColorAttachmentSpecifications.push_back(attachment);
+            }
+            
             Invalidate();
         }
 
         virtual ~OpenGLFramebuffer() {
+            Release();
+        }
+
+        void Release() {
             glDeleteFramebuffers(1, &m_RendererID);
-            glDeleteTextures(1, &m_ColorAttachment);
+            for (uint32_t attachment : m_ColorAttachments)
+                OpenGLStateCache::OnTextureDeleted(attachment);
+            OpenGLStateCache::OnTextureDeleted(m_DepthAttachment);
+            glDeleteTextures((GLsizei)m_ColorAttachments.size(), m_ColorAttachments.data());
             glDeleteTextures(1, &m_DepthAttachment);
+            
+            m_RendererID = 0;
+            m_ColorAttachments.clear();
+            m_DepthAttachment = 0;
         }
 
         void Invalidate() {
-            if (m_RendererID) {
-                glDeleteFramebuffers(1, &m_RendererID);
-                glDeleteTextures(1, &m_ColorAttachment);
-                glDeleteTextures(1, &m_DepthAttachment);
-            }
+            if (m_RendererID)
+                Release();
 
             glGenFramebuffers(1, &m_RendererID);
             glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
 
-            // Color attachment
-            glGenTextures(1, &m_ColorAttachment);
-            glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Specification.Width, m_Specification.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
+            // Color attachments
+            m_ColorAttachments.resize(m_ColorAttachmentSpecifications.size());
+            if (!m_ColorAttachments.empty())
+                glGenTextures((GLsizei)m_ColorAttachments.size(), m_ColorAttachments.data());
+            
+            for (size_t i = 0; i < m_ColorAttachments.size(); i++) {
+                GLenum internalFormat = GL_RGBA8, format = GL_RGBA, type = GL_UNSIGNED_BYTE, filter = GL_LINEAR;
+                switch (m_ColorAttachmentSpecifications[i].TextureFormat) {
+                    case FramebufferTextureFormat::RGBA16F:
+                        internalFormat = GL_RGBA16F;
+                        type = GL_FLOAT;
+                        break;
+                    case FramebufferTextureFormat::RedInteger:
+                        // Integer textures can't be filtered
+                        internalFormat = GL_R32I;
+                        format = GL_RED_INTEGER;
+                        type = GL_INT;
+                        filter = GL_NEAREST;
+                        break;
+                    default:
+                        break;
+                }
+                
+                OpenGLStateCache::BindTextureForUpload(m_ColorAttachments[i]);
+                glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_CapacityWidth, m_CapacityHeight, 0, format, type, nullptr);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + (GLenum)i, GL_TEXTURE_2D, m_ColorAttachments[i], 0);
+            }
 
             // Depth attachment
-            glGenTextures(1, &m_DepthAttachment);
-            glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
+            if (m_DepthAttachmentSpecification.TextureFormat != FramebufferTextureFormat::None) {
+                glGenTextures(1, &m_DepthAttachment);
+                OpenGLStateCache::BindTextureForUpload(m_DepthAttachment);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_CapacityWidth, m_CapacityHeight, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
+            }
+            
+            if (m_ColorAttachments.empty()) {
+                // Depth-only pass
+                glDrawBuffer(GL_NONE);
+                glReadBuffer(GL_NONE);
+            } else {
+                GLenum buffers[8];
+                GE_CORE_ASSERT(m_ColorAttachments.size() <= 8, "Too many framebuffer color attachments!");
+                for (size_t i = 0; i < m_ColorAttachments.size(); i++)
+                    buffers[i] = GL_COLOR_ATTACHMENT0 + (GLenum)i;
+                glDrawBuffers((GLsizei)m_ColorAttachments.size(), buffers);
+            }
 
             // Check framebuffer completeness
             if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
@@ -59,33 +119,91 @@ namespace Engine {
         }
 
         virtual void Resize(uint32_t width, uint32_t height) override {
-            if (width == 0 || height == 0 || width > 8192 || height > 8192) {
+            if (width == 0 || height == 0 || width > MaxSize || height > MaxSize) {
                 GE_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
                 return;
             }
             
             m_Specification.Width = width;
             m_Specification.Height = height;
-            Invalidate();
+            
+            uint32_t capacityWidth = ComputeCapacity(m_CapacityWidth, width);
+            uint32_t capacityHeight = ComputeCapacity(m_CapacityHeight, height);
+            if (capacityWidth != m_CapacityWidth || capacityHeight != m_CapacityHeight) {
+                m_CapacityWidth = capacityWidth;
+                m_CapacityHeight = capacityHeight;
+                Invalidate();
+            }
+        }
+
+        virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) override {
+            GE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+            
+            int pixel = 0;
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererID);
+            glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+            glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, &pixel);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+            return pixel;
+        }
+
+        virtual void ClearAttachment(uint32_t attachmentIndex, int value) override {
+            GE_CORE_ASSERT(attachmentIndex < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+            
+            // Callers may clear a target other than the one they are drawing into
+            GLint previous = 0;
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous);
+
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_RendererID);
+            GLint values[4] = { value, value, value, value };
+            glClearBufferiv(GL_COLOR, attachmentIndex, values);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, (GLuint)previous);
+        }
+
+        virtual uint32_t GetColorAttachmentRendererID(uint32_t index) const override { 
+            GE_CORE_ASSERT(index < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+            return m_ColorAttachments[index]; 
         }
 
-        virtual uint32_t GetColorAttachmentRendererID() const override { 
-            return m_ColorAttachment; 
+        virtual uint32_t GetDepthAttachmentRendererID() const override {
+            return m_DepthAttachment;
         }
 
+        virtual uint32_t GetCapacityWidth() const override { return m_CapacityWidth; }
+        virtual uint32_t GetCapacityHeight() const override { return m_CapacityHeight; }
+
         virtual const FramebufferSpecification& GetSpecification() const override { 
             return m_Specification; 
         }
 
     private:
         uint32_t m_RendererID = 0;
-        uint32_t m_ColorAttachment = 0;
+        std::vector<uint32_t> m_ColorAttachments;
         uint32_t m_DepthAttachment = 0;
         FramebufferSpecification m_Specification;
+        std::vector<FramebufferTextureSpecification> m_ColorAttachmentSpecifications;
+        FramebufferTextureSpecification m_DepthAttachmentSpecification;
+        uint32_t m_CapacityWidth, m_CapacityHeight;
     };
 
+    uint32_t Framebuffer::ComputeCapacity(uint32_t capacity, uint32_t requested) {
+        if (requested <= capacity && requested >= capacity / 2)
+            return capacity;
+        
+        // Round up so small drags don't land on a new size every time
+        uint32_t grown = (requested + requested / 2 + 15) & ~15u;
+        return std::min(grown, MaxSize);
+    }
+
     Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& spec) {
-        return CreateRef<OpenGLFramebuffer>(spec);
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLFramebuffer>(spec);
+            case RendererAPI::API::Null:    return CreateRef<NullFramebuffer>(spec);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
     }
 
 } // namespace Engine
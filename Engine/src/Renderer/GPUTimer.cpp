@@ -0,0 +1,24 @@
+#include "Engine/Renderer/GPUTimer.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Core/Logger.h"
+#include "../Platform/OpenGL/OpenGLGPUTimer.h"
+#include "../Platform/Null/NullGPUTimer.h"
+
+namespace Engine {
+
+    Scope<GPUTimer> GPUTimer::Create(uint32_t latency) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:
+                if (OpenGLGPUTimer::IsAvailable())
+                    return CreateScope<OpenGLGPUTimer>(latency);
+                GE_CORE_WARN("Timer queries not supported, GPU timings will read 0");
+                return CreateScope<NullGPUTimer>();
+            case RendererAPI::API::Null:    return CreateScope<NullGPUTimer>();
+        }
+
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
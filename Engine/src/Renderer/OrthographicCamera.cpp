@@ -1,6 +1,7 @@
 #include "Engine/Renderer/OrthographicCamera.h"
 
 #include <glm/gtc/matrix_transform.hpp>
+#include <limits>
 
 namespace Engine {
 
@@ -44,6 +45,19 @@ namespace Engine {
         m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
     }
 
+    void OrthographicCamera::GetViewBounds(glm::vec2& min, glm::vec2& max) const {
+        glm::mat4 inverseViewProjection = glm::inverse(m_ViewProjectionMatrix);
+        constexpr glm::vec2 ndcCorners[] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+        
+        min = glm::vec2(std::numeric_limits<float>::max());
+        max = glm::vec2(std::numeric_limits<float>::lowest());
+        for (const glm::vec2& ndc : ndcCorners) {
+            glm::vec2 world = glm::vec2(inverseViewProjection * glm::vec4(ndc, 0.0f, 1.0f));
+            min = glm::min(min, world);
+            max = glm::max(max, world);
+        }
+    }
+
     void OrthographicCamera::RecalculateViewMatrix() {
         glm::mat4 transform = glm::translate(glm::mat4(1.0f), m_Position) *
             glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation), glm::vec3(0, 0, 1));
@@ -69,26 +69,36 @@ namespace Engine {
 
     void ParticleSystem::OnRender()
     {
+        m_RenderPositions.clear();
+        m_RenderSizes.clear();
+        m_RenderRotations.clear();
+        m_RenderColors.clear();
+
         for (auto& particle : m_ParticlePool)
         {
             if (!particle.Active)
                 continue;
 
-            // Fade away particles
             float life = particle.LifeRemaining / particle.LifeTime;
+            float size = glm::lerp(particle.SizeEnd, particle.SizeBegin, life);
+
+            // Rotated square, so bound by its half diagonal
+            if (!Renderer2D::IsVisible(particle.Position, glm::vec2(size * 0.7072f)))
+                continue;
+
+            // Fade away particles
             glm::vec4 color = glm::lerp(particle.ColorEnd, particle.ColorBegin, life);
             color.a = color.a * life;
 
-            float size = glm::lerp(particle.SizeEnd, particle.SizeBegin, life);
-
-            // Render particle
-            Renderer2D::DrawRotatedQuad(
-                { particle.Position.x, particle.Position.y, 0.0f },
-                { size, size },
-                particle.Rotation,
-                color
-            );
+            m_RenderPositions.push_back({ particle.Position.x, particle.Position.y, 0.0f });
+            m_RenderSizes.push_back({ size, size });
+            m_RenderRotations.push_back(particle.Rotation);
+            m_RenderColors.push_back(color);
         }
+
+        // Render all particles in one go
+        Renderer2D::DrawRotatedQuads(m_RenderPositions.data(), m_RenderSizes.data(), m_RenderRotations.data(),
+                                     m_RenderColors.data(), (uint32_t)m_RenderPositions.size());
     }
 
     void ParticleSystem::Clear()
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GE_QUAD_KERNELS_SSE 1
+    #include <emmintrin.h>
+#else
+    #define GE_QUAD_KERNELS_SSE 0
+#endif
+
+// Corner kernels for Renderer2D. Quads are unit squares centred on the origin,
+// so the corners follow directly from position, half-size and sin/cos without
+// building a model matrix. Corner order matches Renderer2D's texture coordinates:
+// bottom-left, bottom-right, top-right, top-left.
+
+namespace Engine {
+
+    inline void ComputeQuadCorners(const glm::vec3& position, const glm::vec2& size, glm::vec3 corners[4]) {
+        const float hx = size.x * 0.5f;
+        const float hy = size.y * 0.5f;
+
+        corners[0] = { position.x - hx, position.y - hy, position.z };
+        corners[1] = { position.x + hx, position.y - hy, position.z };
+        corners[2] = { position.x + hx, position.y + hy, position.z };
+        corners[3] = { position.x - hx, position.y + hy, position.z };
+    }
+
+    inline void ComputeRotatedQuadCorners(const glm::vec3& position, const glm::vec2& size, float radians, glm::vec3 corners[4]) {
+        const float s = std::sin(radians);
+        const float c = std::cos(radians);
+
+        // Rotated half-extent axes
+        const float ax = size.x * 0.5f * c, ay = size.x * 0.5f * s;
+        const float bx = -size.y * 0.5f * s, by = size.y * 0.5f * c;
+
+        corners[0] = { position.x - ax - bx, position.y - ay - by, position.z };
+        corners[1] = { position.x + ax - bx, position.y + ay - by, position.z };
+        corners[2] = { position.x + ax + bx, position.y + ay + by, position.z };
+        corners[3] = { position.x - ax + bx, position.y - ay + by, position.z };
+    }
+
+    // Batch variant over structure-of-arrays input. Writes 4 corners per quad to
+    // corners[i * 4 + k]. Rotations are in degrees, as Renderer2D takes them, so
+    // callers need no converted copy.
+    inline void ComputeRotatedQuadCornersBatch(const glm::vec3* positions, const glm::vec2* sizes, const float* degrees,
+                                               uint32_t count, glm::vec3* corners) {
+        uint32_t i = 0;
+
+#if GE_QUAD_KERNELS_SSE
+        const __m128 half = _mm_set1_ps(0.5f);
+
+        for (; i + 4 <= count; i += 4) {
+            alignas(16) float px[4], py[4], hx[4], hy[4], s[4], c[4];
+            for (uint32_t j = 0; j < 4; j++) {
+                px[j] = positions[i + j].x;
+                py[j] = positions[i + j].y;
+                hx[j] = sizes[i + j].x;
+                hy[j] = sizes[i + j].y;
+                const float radians = glm::radians(degrees[i + j]);
+                s[j] = std::sin(radians);
+                c[j] = std::cos(radians);
+            }
+
+            const __m128 vpx = _mm_load_ps(px);
+            const __m128 vpy = _mm_load_ps(py);
+            const __m128 vhx = _mm_mul_ps(_mm_load_ps(hx), half);
+            const __m128 vhy = _mm_mul_ps(_mm_load_ps(hy), half);
+            const __m128 vs = _mm_load_ps(s);
+            const __m128 vc = _mm_load_ps(c);
+
+            const __m128 ax = _mm_mul_ps(vhx, vc);
+            const __m128 ay = _mm_mul_ps(vhx, vs);
+            const __m128 bx = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(vhy, vs));
+            const __m128 by = _mm_mul_ps(vhy, vc);
+
+            alignas(16) float x[4][4], y[4][4];
+            _mm_store_ps(x[0], _mm_sub_ps(_mm_sub_ps(vpx, ax), bx));
+            _mm_store_ps(y[0], _mm_sub_ps(_mm_sub_ps(vpy, ay), by));
+            _mm_store_ps(x[1], _mm_sub_ps(_mm_add_ps(vpx, ax), bx));
+            _mm_store_ps(y[1], _mm_sub_ps(_mm_add_ps(vpy, ay), by));
+            _mm_store_ps(x[2], _mm_add_ps(_mm_add_ps(vpx, ax), bx));
+            _mm_store_ps(y[2], _mm_add_ps(_mm_add_ps(vpy, ay), by));
+            _mm_store_ps(x[3], _mm_add_ps(_mm_sub_ps(vpx, ax), bx));
+            _mm_store_ps(y[3], _mm_add_ps(_mm_sub_ps(vpy, ay), by));
+
+            for (uint32_t j = 0; j < 4; j++) {
+                glm::vec3* out = corners + (size_t)(i + j) * 4;
+                const float z = positions[i + j].z;
+                for (uint32_t k = 0; k < 4; k++)
+                    out[k] = { x[k][j], y[k][j], z };
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+            ComputeRotatedQuadCorners(positions[i], sizes[i], glm::radians(degrees[i]), corners + (size_t)i * 4);
+    }
+
+}
@@ -0,0 +1,78 @@
+#include "Engine/Renderer/RenderTargetPool.h"
+
+namespace Engine {
+
+    static bool SameAttachments(const FramebufferSpecification& a, const FramebufferSpecification& b) {
+        if (a.Samples != b.Samples || a.Attachments.Attachments.size() != b.Attachments.Attachments.size())
+            return false;
+        
+        for (size_t i = 0; i < a.Attachments.Attachments.size(); i++) {
+            if (a.Attachments.Attachments[i].TextureFormat != b.Attachments.Attachments[i].TextureFormat)
+                return false;
+        }
+        return true;
+    }
+
+    Ref<Framebuffer> RenderTargetPool::Acquire(const FramebufferSpecification& spec) {
+        // Prefer the smallest free target that fits, so large targets stay available for
+        // large requests
+        Entry* best = nullptr;
+        uint64_t bestArea = UINT64_MAX;
+        
+        for (Entry& entry : m_Entries) {
+            // The pool's own Ref is the only one left
+            if (entry.Target.use_count() > 1)
+                continue;
+            
+            const Ref<Framebuffer>& target = entry.Target;
+            if (!SameAttachments(target->GetSpecification(), spec))
+                continue;
+            // Skip targets that would have to reallocate, whether too small or much too large
+            if (Framebuffer::ComputeCapacity(target->GetCapacityWidth(), spec.Width) != target->GetCapacityWidth() ||
+                Framebuffer::ComputeCapacity(target->GetCapacityHeight(), spec.Height) != target->GetCapacityHeight())
+                continue;
+            
+            uint64_t area = (uint64_t)target->GetCapacityWidth() * target->GetCapacityHeight();
+            if (area < bestArea) {
+                best = &entry;
+                bestArea = area;
+            }
+        }
+        
+        if (best) {
+            // Only moves the viewport, the capacity already fits
+            best->Target->Resize(spec.Width, spec.Height);
+            best->IdleFrames = 0;
+            m_Stats.Reused++;
+            return best->Target;
+        }
+        
+        Ref<Framebuffer> target = Framebuffer::Create(spec);
+        m_Entries.push_back({ target, 0 });
+        m_Stats.Created++;
+        m_Stats.Targets = (uint32_t)m_Entries.size();
+        return target;
+    }
+
+    void RenderTargetPool::EndFrame() {
+        for (Entry& entry : m_Entries) {
+            if (entry.Target.use_count() > 1)
+                entry.IdleFrames = 0;
+            else
+                entry.IdleFrames++;
+        }
+        
+        m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(),
+            [](const Entry& entry) { return entry.IdleFrames > MaxIdleFrames; }), m_Entries.end());
+        
+        m_Stats.Targets = (uint32_t)m_Entries.size();
+        m_Stats.Reused = 0;
+        m_Stats.Created = 0;
+    }
+
+    void RenderTargetPool::Clear() {
+        m_Entries.clear();
+        m_Stats = {};
+    }
+
+}
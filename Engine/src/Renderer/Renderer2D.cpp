@@ -2,11 +2,56 @@
 #include "Engine/Renderer/VertexArray.h"
 #include "Engine/Renderer/Shader.h"
 #include "Engine/Renderer/RenderCommand.h"
+#include "Engine/Renderer/Font.h"
+#include "Engine/Renderer/TextureArrayAllocator.h"
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Core/Logger.h"
+#include "QuadKernels.h"
 
 #include <glm/gtc/matrix_transform.hpp>
+#include <unordered_map>
 
 namespace Engine {
 
+    static uint32_t PackColorRGBA8(const glm::vec4& color) {
+        const glm::vec4 scaled = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+        return (uint32_t)scaled.r | ((uint32_t)scaled.g << 8) | ((uint32_t)scaled.b << 16) | ((uint32_t)scaled.a << 24);
+    }
+
+#if GE_COMPACT_QUAD_VERTICES
+    // 24 bytes: RGBA8 color, unorm16 texcoords, and the texture index (low 16 bits)
+    // packed with an 8.8 fixed-point tiling factor (high 16 bits)
+    struct QuadVertex {
+        glm::vec3 Position;
+        uint32_t Color;
+        uint16_t TexCoord[2];
+        uint32_t TexIndexTiling;
+    };
+
+    using QuadVertexColor = uint32_t;
+
+    static const char* const QuadShaderPath = "assets/shaders/TextureCompact.glsl";
+    static const char* const ArrayShaderPath = "assets/shaders/TextureArrayCompact.glsl";
+
+    static QuadVertexColor EncodeQuadVertexColor(const glm::vec4& color) {
+        return PackColorRGBA8(color);
+    }
+
+    static QuadVertex MakeQuadVertex(const glm::vec3& position, QuadVertexColor color, const glm::vec2& texCoord,
+                                     float texIndex, float tilingFactor) {
+        QuadVertex vertex;
+        vertex.Position = position;
+        vertex.Color = color;
+        vertex.TexCoord[0] = (uint16_t)(glm::clamp(texCoord.x, 0.0f, 1.0f) * 65535.0f + 0.5f);
+        vertex.TexCoord[1] = (uint16_t)(glm::clamp(texCoord.y, 0.0f, 1.0f) * 65535.0f + 0.5f);
+        vertex.TexIndexTiling = (uint32_t)texIndex | ((uint32_t)(glm::clamp(tilingFactor, 0.0f, 255.99f) * 256.0f + 0.5f) << 16);
+        return vertex;
+    }
+
+    static void SetQuadVertexTexIndex(QuadVertex& vertex, float texIndex) {
+        vertex.TexIndexTiling = (vertex.TexIndexTiling & 0xFFFF0000u) | (uint32_t)texIndex;
+    }
+#else
     struct QuadVertex {
         glm::vec3 Position;
         glm::vec4 Color;
@@ -15,6 +60,118 @@ namespace Engine {
         float TilingFactor;
     };
 
+    using QuadVertexColor = glm::vec4;
+
+    static const char* const QuadShaderPath = "assets/shaders/Texture.glsl";
+    static const char* const ArrayShaderPath = "assets/shaders/TextureArray.glsl";
+
+    static QuadVertexColor EncodeQuadVertexColor(const glm::vec4& color) {
+        return color;
+    }
+
+    static QuadVertex MakeQuadVertex(const glm::vec3& position, QuadVertexColor color, const glm::vec2& texCoord,
+                                     float texIndex, float tilingFactor) {
+        return { position, color, texCoord, texIndex, tilingFactor };
+    }
+
+    static void SetQuadVertexTexIndex(QuadVertex& vertex, float texIndex) {
+        vertex.TexIndex = texIndex;
+    }
+#endif
+
+    struct CircleVertex {
+        glm::vec3 WorldPosition;
+        glm::vec2 LocalPosition;
+        glm::vec4 Color;
+        float Thickness;
+        float Fade;
+    };
+
+    // 16 bytes, RGBA8 color
+    struct LineVertex {
+        glm::vec3 Position;
+        uint32_t Color;
+    };
+
+    // Per-instance record for the instanced path (68 bytes vs 4 * 48 per vertex quad)
+    struct QuadInstance {
+        glm::vec3 Position;
+        glm::vec2 Size;
+        glm::vec2 Rotation;    // cos, sin
+        glm::vec4 Color;
+        glm::vec4 TexRect;     // min uv, max uv
+        float TexIndex;
+        float TilingFactor;
+    };
+
+    // Quad recorded in sorted submission mode, expanded into vertices at EndScene
+    struct QuadCommand {
+        glm::vec3 Position;
+        glm::vec2 Size;
+        float Rotation;        // Degrees
+        glm::vec4 Color;
+        float TilingFactor;
+        int32_t TextureIndex;  // Index into Renderer2DData::SortTextures, -1 = untextured
+        int32_t LayerIndex;    // Index into Renderer2DData::SortLayers, -1 = not a texture array quad
+        int32_t StaticIndex;   // Index into Renderer2DData::SortStaticParts, -1 = not a static batch part
+        glm::vec4 TexRect;     // min uv, max uv
+        bool Rotated;
+        bool Circle;           // Size.x is the radius
+        float Thickness;
+        float Fade;
+    };
+
+    // One draw of a static batch: at most MaxQuads quads sharing one set of texture slots
+    struct StaticQuadBatchPart {
+        Ref<VertexArray> QuadVertexArray;
+        uint32_t IndexCount = 0;
+        std::vector<Ref<Texture2D>> Textures; // Slot order, slot 0 = white texture
+        glm::vec3 BoundsMin = glm::vec3(0.0f); // Of the corners, for culling and sorting
+        glm::vec3 BoundsMax = glm::vec3(0.0f);
+        bool Opaque = true;                    // Every quad passes IsOpaqueQuad
+    };
+
+    // Static batch part recorded in Sorted or Layered mode, drawn when its key comes up
+    struct StaticPartCommand {
+        Ref<StaticQuadBatch> Batch;
+        uint32_t Part;
+        glm::mat4 Transform;
+    };
+
+    class StaticQuadBatch {
+    public:
+        std::vector<StaticQuadBatchPart> Parts;
+    };
+
+    // Laid-out string. Vertices are expanded once in layout space, with a white color
+    // and slot 0, and placed, tinted and given the atlas slot as each draw copies them.
+    struct TextCacheEntry {
+        std::vector<GlyphQuad> Quads;
+        glm::vec2 BoundsMin = glm::vec2(0.0f);
+        glm::vec2 BoundsMax = glm::vec2(0.0f);
+        
+        std::vector<QuadVertex> Vertices;
+    };
+
+    struct FontTextCache {
+        Ref<Font> FontRef; // Keeps the font alive so its address can't be reused as a key
+        std::unordered_map<std::string, TextCacheEntry> Strings;
+    };
+
+    struct QuadSortEntry {
+        uint64_t Key;
+        uint32_t Index;
+    };
+
+    // Open-addressed renderer ID -> slot table for the current batch. Entries are
+    // stamped with the batch generation, so starting a batch invalidates them all
+    // without touching the table.
+    struct TextureSlotEntry {
+        uint32_t RendererID = 0;
+        uint32_t Generation = 0;
+        uint32_t Slot = 0;
+    };
+
     struct Renderer2DData {
         static const uint32_t MaxQuads = 20000;
         static const uint32_t MaxVertices = MaxQuads * 4;
@@ -22,28 +179,475 @@ namespace Engine {
         static const uint32_t MaxTextureSlots = 16; // macOS/OpenGL 4.1 limit
         
         Ref<VertexArray> QuadVertexArray;
-        Ref<VertexBuffer> QuadVertexBuffer;
+        Ref<StreamingVertexBuffer> QuadVertexBuffer;
+        Ref<IndexBuffer> QuadIndexBuffer;
         Ref<Shader> TextureShader;
         Ref<Texture2D> WhiteTexture;
         
         uint32_t QuadIndexCount = 0;
-        QuadVertex* QuadVertexBufferBase = nullptr;
+        QuadVertex* QuadVertexBufferBase = nullptr; // Mapped region of QuadVertexBuffer, write-only
         QuadVertex* QuadVertexBufferPtr = nullptr;
         
         std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
         uint32_t TextureSlotIndex = 1; // 0 = white texture
         
-        glm::vec4 QuadVertexPositions[4];
+        static const uint32_t TextureSlotTableSize = MaxTextureSlots * 2; // Power of two, load <= 0.5
+        std::array<TextureSlotEntry, TextureSlotTableSize> TextureSlotTable;
+        uint32_t TextureSlotGeneration = 1;
+        
+        std::vector<glm::vec3> CornerScratch; // Batch corner kernel output
+        
+        // Circles, batched separately from quads
+        Ref<VertexArray> CircleVertexArray;
+        Ref<StreamingVertexBuffer> CircleVertexBuffer;
+        Ref<Shader> CircleShader;
+        uint32_t CircleIndexCount = 0;
+        CircleVertex* CircleVertexBufferBase = nullptr;
+        CircleVertex* CircleVertexBufferPtr = nullptr;
+        
+        // Texture array quads, batched separately; one array bound per batch
+        Ref<VertexArray> ArrayVertexArray;
+        Ref<StreamingVertexBuffer> ArrayVertexBuffer;
+        Ref<Shader> ArrayShader;
+        Ref<Texture2DArray> CurrentArray;
+        uint32_t ArrayIndexCount = 0;
+        QuadVertex* ArrayVertexBufferBase = nullptr;
+        QuadVertex* ArrayVertexBufferPtr = nullptr;
+        
+        // Lines, batched separately as GL_LINES
+        static const uint32_t MaxLineVertices = MaxVertices;
+        Ref<VertexArray> LineVertexArray;
+        Ref<StreamingVertexBuffer> LineVertexBuffer;
+        Ref<Shader> LineShader;
+        uint32_t LineVertexCount = 0;
+        LineVertex* LineVertexBufferBase = nullptr;
+        LineVertex* LineVertexBufferPtr = nullptr;
+        
+        // Instanced path
+        bool Instanced = false;
+        Ref<VertexArray> InstanceVertexArray;
+        Ref<VertexBuffer> InstanceVertexBuffer;
+        Ref<Shader> InstancedShader;
+        uint32_t InstanceCount = 0;
+        QuadInstance* InstanceBufferBase = nullptr;
+        QuadInstance* InstanceBufferPtr = nullptr;
+        
+        // Text layouts, dropped wholesale once MaxCachedStrings is exceeded
+        static const uint32_t MaxCachedStrings = 1024;
+        std::unordered_map<const Font*, FontTextCache> TextCache;
+        uint32_t CachedStringCount = 0;
+        
+        // View bounds of the current scene's camera
+        glm::vec2 ViewMin = glm::vec2(0.0f);
+        glm::vec2 ViewMax = glm::vec2(0.0f);
+        glm::mat4 ViewProjection = glm::mat4(1.0f);
+        
+        // Sorted submission
+        Renderer2D::SubmissionMode Mode = Renderer2D::SubmissionMode::Immediate;
+        bool ReplayingSorted = false;
+        uint8_t SortLayer = 0;
+        std::vector<QuadCommand> QuadCommands;
+        std::vector<QuadSortEntry> SortEntries;
+        std::vector<QuadSortEntry> SortScratch;
+        std::vector<Ref<Texture2D>> SortTextures; // Keeps recorded textures alive until EndScene
+        std::vector<Ref<TextureLayer>> SortLayers;
+        std::vector<StaticPartCommand> SortStaticParts;
+        std::unordered_map<uint32_t, uint32_t> SortTextureLookup;
+        
+        // Parallel recording, one recorder per slice, reused across frames
+        static const uint32_t RecordSliceSize = 512;
+        std::vector<Scope<QuadRecorder>> Recorders;
         
         Renderer2D::Statistics Stats;
     };
 
     static Renderer2DData s_Data;
 
+    // Key layout, most significant first:
+    //   [63..56] layer  [55..32] depth (24-bit, back to front)  [31..24] shader  [23..0] texture
+    static uint64_t MakeQuadSortKey(uint8_t layer, float z, uint8_t shader, uint32_t textureID) {
+        // Orthographic cameras clip z to [-1, 1]; lower z is further away
+        float normalizedDepth = glm::clamp((z + 1.0f) * 0.5f, 0.0f, 1.0f);
+        uint64_t depth = (uint64_t)(normalizedDepth * (float)0xFFFFFF);
+        
+        return ((uint64_t)layer << 56)
+            | (depth << 32)
+            | ((uint64_t)shader << 24)
+            | (uint64_t)(textureID & 0xFFFFFF);
+    }
+
+    // Layered mode key, most significant first:
+    //   [63] pass (0 = opaque, 1 = transparent)  [62..55] layer  [54..31] depth
+    //   [30..24] shader  [23..0] texture
+    // Opaque keys invert layer and depth so that pass runs front to back.
+    static uint64_t MakeLayeredSortKey(bool opaque, uint8_t layer, float z, uint8_t shader, uint32_t textureID) {
+        float normalizedDepth = glm::clamp((z + 1.0f) * 0.5f, 0.0f, 1.0f);
+        uint64_t depth = (uint64_t)(normalizedDepth * (float)0xFFFFFF);
+        uint64_t passLayer = layer;
+        
+        if (opaque) {
+            depth = 0xFFFFFF - depth;
+            passLayer = 0xFF - passLayer;
+        } else {
+            passLayer |= 0x100;
+        }
+        
+        return (passLayer << 55)
+            | (depth << 31)
+            | ((uint64_t)(shader & 0x7F) << 24)
+            | (uint64_t)(textureID & 0xFFFFFF);
+    }
+
+    static uint64_t MakeSubmissionKey(bool opaque, uint8_t layer, float z, uint8_t shader, uint32_t textureID) {
+        if (s_Data.Mode == Renderer2D::SubmissionMode::Layered)
+            return MakeLayeredSortKey(opaque, layer, z, shader, textureID);
+        return MakeQuadSortKey(layer, z, shader, textureID);
+    }
+
+    static bool IsLayeredTransparent(uint64_t key) {
+        return (key >> 63) != 0;
+    }
+
+    static uint8_t GetLayeredSortLayer(uint64_t key) {
+        uint8_t passLayer = (uint8_t)((key >> 55) & 0xFF);
+        return IsLayeredTransparent(key) ? passLayer : (uint8_t)(0xFF - passLayer);
+    }
+
+    // Opaque only if nothing can be blended: full alpha tint and a texture without an
+    // alpha channel. BC1 may carry 1-bit alpha, so only RGB8 qualifies.
+    static bool IsOpaqueQuad(const glm::vec4& color, const Ref<Texture2D>& texture) {
+        return color.a >= 1.0f && (!texture || texture->GetFormat() == ImageFormat::RGB8);
+    }
+
+    // Stable LSD radix sort, 8 bits per pass. Passes where every key shares the
+    // same byte are skipped, so typical scenes only pay for the texture bytes.
+    static void RadixSortQuads(std::vector<QuadSortEntry>& entries, std::vector<QuadSortEntry>& scratch) {
+        const size_t count = entries.size();
+        if (count < 2)
+            return;
+        
+        scratch.resize(count);
+        QuadSortEntry* src = entries.data();
+        QuadSortEntry* dst = scratch.data();
+        
+        for (uint32_t shift = 0; shift < 64; shift += 8) {
+            uint32_t histogram[256] = {};
+            for (size_t i = 0; i < count; i++)
+                histogram[(src[i].Key >> shift) & 0xFF]++;
+            
+            if (histogram[(src[0].Key >> shift) & 0xFF] == count)
+                continue;
+            
+            uint32_t offset = 0;
+            for (uint32_t bucket = 0; bucket < 256; bucket++) {
+                uint32_t bucketCount = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketCount;
+            }
+            
+            for (size_t i = 0; i < count; i++)
+                dst[histogram[(src[i].Key >> shift) & 0xFF]++] = src[i];
+            
+            std::swap(src, dst);
+        }
+        
+        if (src != entries.data())
+            std::copy(src, src + count, entries.data());
+    }
+
+    // Index into SortTextures, -1 for the white texture
+    static int32_t GetSortTextureIndex(const Ref<Texture2D>& texture) {
+        if (!texture)
+            return -1;
+        
+        const uint32_t textureID = texture->GetRendererID();
+        auto it = s_Data.SortTextureLookup.find(textureID);
+        if (it != s_Data.SortTextureLookup.end())
+            return (int32_t)it->second;
+        
+        int32_t index = (int32_t)s_Data.SortTextures.size();
+        s_Data.SortTextureLookup[textureID] = (uint32_t)index;
+        s_Data.SortTextures.push_back(texture);
+        return index;
+    }
+
+    static void RecordQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                           const glm::vec4& color, const Ref<Texture2D>& texture, float tilingFactor,
+                           const glm::vec4& texRect = { 0.0f, 0.0f, 1.0f, 1.0f }) {
+        QuadCommand command;
+        command.Position = position;
+        command.Size = size;
+        command.Rotation = rotation;
+        command.Color = color;
+        command.TilingFactor = tilingFactor;
+        command.TextureIndex = GetSortTextureIndex(texture);
+        command.LayerIndex = -1;
+        command.StaticIndex = -1;
+        command.TexRect = texRect;
+        command.Rotated = rotated;
+        command.Circle = false;
+        command.Thickness = 0.0f;
+        command.Fade = 0.0f;
+        
+        uint32_t textureID = texture ? texture->GetRendererID() : 0; // White texture sorts first
+        uint64_t key = MakeSubmissionKey(IsOpaqueQuad(color, texture), s_Data.SortLayer, position.z, 0, textureID);
+        s_Data.SortEntries.push_back({ key, (uint32_t)s_Data.QuadCommands.size() });
+        s_Data.QuadCommands.push_back(command);
+        
+        s_Data.Stats.SortedQuadCount++;
+    }
+
+    static QuadCommand MakeCircleCommand(const glm::vec3& position, float radius, const glm::vec4& color, float thickness, float fade) {
+        QuadCommand command;
+        command.Position = position;
+        command.Size = { radius, radius };
+        command.Rotation = 0.0f;
+        command.Color = color;
+        command.TilingFactor = 1.0f;
+        command.TextureIndex = -1;
+        command.LayerIndex = -1;
+        command.StaticIndex = -1;
+        command.TexRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+        command.Rotated = false;
+        command.Circle = true;
+        command.Thickness = thickness;
+        command.Fade = fade;
+        return command;
+    }
+
+    // Antialiased edges need blending, so circles always sort as transparent
+    static uint64_t MakeCircleKey(const glm::vec3& position) {
+        return MakeSubmissionKey(false, s_Data.SortLayer, position.z, 1, 0);
+    }
+
+    static void RecordCircle(const glm::vec3& position, float radius, const glm::vec4& color, float thickness, float fade) {
+        s_Data.SortEntries.push_back({ MakeCircleKey(position), (uint32_t)s_Data.QuadCommands.size() });
+        s_Data.QuadCommands.push_back(MakeCircleCommand(position, radius, color, thickness, fade));
+        
+        s_Data.Stats.SortedQuadCount++;
+    }
+
+    static void RecordArrayQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                                const glm::vec4& color, const Ref<TextureLayer>& layer, float tilingFactor) {
+        QuadCommand command;
+        command.Position = position;
+        command.Size = size;
+        command.Rotation = rotation;
+        command.Color = color;
+        command.TilingFactor = tilingFactor;
+        command.TextureIndex = -1;
+        command.LayerIndex = (int32_t)s_Data.SortLayers.size();
+        command.StaticIndex = -1;
+        command.TexRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+        command.Rotated = rotated;
+        command.Circle = false;
+        command.Thickness = 0.0f;
+        command.Fade = 0.0f;
+        s_Data.SortLayers.push_back(layer);
+        
+        uint64_t key = MakeSubmissionKey(false, s_Data.SortLayer, position.z, 2, layer->GetArray()->GetRendererID());
+        s_Data.SortEntries.push_back({ key, (uint32_t)s_Data.QuadCommands.size() });
+        s_Data.QuadCommands.push_back(command);
+        
+        s_Data.Stats.SortedQuadCount++;
+    }
+
+    static bool ShouldRecordQuad() {
+        return s_Data.Mode != Renderer2D::SubmissionMode::Immediate && !s_Data.ReplayingSorted;
+    }
+
+    // World bounds of a part's corner bounds under transform
+    static void GetStaticPartBounds(const StaticQuadBatchPart& part, const glm::mat4& transform, glm::vec3& min, glm::vec3& max) {
+        for (uint32_t i = 0; i < 8; i++) {
+            const glm::vec4 corner = {
+                (i & 1) ? part.BoundsMax.x : part.BoundsMin.x,
+                (i & 2) ? part.BoundsMax.y : part.BoundsMin.y,
+                (i & 4) ? part.BoundsMax.z : part.BoundsMin.z,
+                1.0f
+            };
+            const glm::vec3 world = glm::vec3(transform * corner);
+            min = i == 0 ? world : glm::min(min, world);
+            max = i == 0 ? world : glm::max(max, world);
+        }
+    }
+
+    // The transform goes into the view projection, the vertices stay as baked.
+    // Callers break the batch first so pending quads keep their place.
+    static void DrawStaticPart(const StaticQuadBatchPart& part, const glm::mat4& transform) {
+        s_Data.TextureShader->Bind();
+        s_Data.TextureShader->SetMat4("u_ViewProjection", s_Data.ViewProjection * transform);
+        
+        for (uint32_t i = 0; i < (uint32_t)part.Textures.size(); i++)
+            part.Textures[i]->Bind(i);
+        
+        part.QuadVertexArray->Bind();
+        RenderCommand::DrawIndexed(part.QuadVertexArray, part.IndexCount);
+        s_Data.Stats.DrawCalls++;
+        s_Data.Stats.StaticQuadCount += part.IndexCount / 6;
+        
+        s_Data.TextureShader->SetMat4("u_ViewProjection", s_Data.ViewProjection);
+    }
+
+    // Circle recorded in Immediate mode. Circles have their own vertex layout, so they
+    // can't share the expanded quad stream; QuadIndex keeps their place in it.
+    struct RecordedCircle {
+        glm::vec3 Position;
+        float Radius;
+        glm::vec4 Color;
+        float Thickness;
+        float Fade;
+        uint32_t QuadIndex;    // Quads recorded before this circle
+    };
+
+    // Expanded quads in Immediate mode; commands with precomputed sort keys in Sorted
+    // and instanced mode. Texture indices are local to the recorder until the merge.
+    struct QuadRecorder::Storage {
+        bool Expand = true;
+        std::vector<QuadVertex> Vertices;       // 4 per quad, TexIndex patched at merge
+        std::vector<int32_t> QuadTextures;      // Per expanded quad, -1 = white texture
+        std::vector<QuadCommand> Commands;      // TextureIndex is local, circles included
+        std::vector<uint64_t> Keys;             // Per command
+        std::vector<Ref<Texture2D>> Textures;
+        std::vector<RecordedCircle> Circles;    // Immediate mode only
+        uint32_t Culled = 0;
+        
+        void Reset(bool expand) {
+            Expand = expand;
+            Vertices.clear();
+            QuadTextures.clear();
+            Commands.clear();
+            Keys.clear();
+            Textures.clear();
+            Circles.clear();
+            Culled = 0;
+        }
+        
+        int32_t GetTextureIndex(const Ref<Texture2D>& texture) {
+            if (!texture)
+                return -1;
+            
+            // Consecutive sprites usually share a texture
+            if (!Textures.empty() && Textures.back() == texture)
+                return (int32_t)Textures.size() - 1;
+            
+            for (size_t i = 0; i < Textures.size(); i++) {
+                if (Textures[i] == texture)
+                    return (int32_t)i;
+            }
+            
+            Textures.push_back(texture);
+            return (int32_t)Textures.size() - 1;
+        }
+    };
+
+    QuadRecorder::QuadRecorder()
+        : m_Storage(CreateScope<Storage>()) {
+    }
+
+    QuadRecorder::~QuadRecorder() = default;
+
+    void QuadRecorder::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        Record(position, size, 0.0f, false, nullptr, textureCoords, 1.0f, color);
+    }
+
+    void QuadRecorder::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        Record(position, size, 0.0f, false, texture, textureCoords, tilingFactor, tintColor);
+    }
+
+    void QuadRecorder::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        Record(position, size, 0.0f, false, subTexture->GetTexture(), subTexture->GetTexCoords(), tilingFactor, tintColor);
+    }
+
+    void QuadRecorder::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        Record(position, size, rotation, true, nullptr, textureCoords, 1.0f, color);
+    }
+
+    void QuadRecorder::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        Record(position, size, rotation, true, texture, textureCoords, tilingFactor, tintColor);
+    }
+
+    void QuadRecorder::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        Record(position, size, rotation, true, subTexture->GetTexture(), subTexture->GetTexCoords(), tilingFactor, tintColor);
+    }
+
+    void QuadRecorder::DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color, float thickness, float fade) {
+        Storage& storage = *m_Storage;
+        if (storage.Expand) {
+            storage.Circles.push_back({ position, radius, color, thickness, fade, (uint32_t)storage.QuadTextures.size() });
+            return;
+        }
+        
+        storage.Commands.push_back(MakeCircleCommand(position, radius, color, thickness, fade));
+        storage.Keys.push_back(MakeCircleKey(position));
+    }
+
+    bool QuadRecorder::IsVisible(const glm::vec2& center, const glm::vec2& halfExtent) {
+        if (center.x + halfExtent.x < s_Data.ViewMin.x || center.x - halfExtent.x > s_Data.ViewMax.x ||
+            center.y + halfExtent.y < s_Data.ViewMin.y || center.y - halfExtent.y > s_Data.ViewMax.y) {
+            m_Storage->Culled++;
+            return false;
+        }
+        
+        return true;
+    }
+
+    void QuadRecorder::Record(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                              const Ref<Texture2D>& texture, const glm::vec2* texCoords, float tilingFactor,
+                              const glm::vec4& tintColor) {
+        Storage& storage = *m_Storage;
+        const int32_t textureIndex = storage.GetTextureIndex(texture);
+        
+        if (storage.Expand) {
+            // Same kernels and vertex layout as the immediate path
+            glm::vec3 corners[4];
+            if (rotated)
+                ComputeRotatedQuadCorners(position, size, glm::radians(rotation), corners);
+            else
+                ComputeQuadCorners(position, size, corners);
+            
+            const QuadVertexColor vertexColor = EncodeQuadVertexColor(tintColor);
+            for (size_t i = 0; i < 4; i++)
+                storage.Vertices.push_back(MakeQuadVertex(corners[i], vertexColor, texCoords[i], 0.0f, tilingFactor));
+            storage.QuadTextures.push_back(textureIndex);
+            return;
+        }
+        
+        QuadCommand command;
+        command.Position = position;
+        command.Size = size;
+        command.Rotation = rotation;
+        command.Color = tintColor;
+        command.TilingFactor = tilingFactor;
+        command.TextureIndex = textureIndex;
+        command.LayerIndex = -1;
+        command.StaticIndex = -1;
+        command.TexRect = { texCoords[0].x, texCoords[0].y, texCoords[2].x, texCoords[2].y };
+        command.Rotated = rotated;
+        command.Circle = false;
+        command.Thickness = 0.0f;
+        command.Fade = 0.0f;
+        
+        uint32_t textureID = texture ? texture->GetRendererID() : 0;
+        storage.Commands.push_back(command);
+        storage.Keys.push_back(MakeSubmissionKey(IsOpaqueQuad(tintColor, texture), s_Data.SortLayer, position.z, 0, textureID));
+    }
+
     void Renderer2D::Init() {
         s_Data.QuadVertexArray = VertexArray::Create();
         
-        s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
+        s_Data.QuadVertexBuffer = StreamingVertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
+#if GE_COMPACT_QUAD_VERTICES
+        s_Data.QuadVertexBuffer->SetLayout({
+            { ShaderDataType::Float3,  "a_Position" },
+            { ShaderDataType::UByte4,  "a_Color",    true },
+            { ShaderDataType::UShort2, "a_TexCoord", true },
+            { ShaderDataType::UInt,    "a_TexIndexTiling" }
+        });
+#else
         s_Data.QuadVertexBuffer->SetLayout({
             { ShaderDataType::Float3, "a_Position" },
             { ShaderDataType::Float4, "a_Color" },
@@ -51,10 +655,9 @@ namespace Engine {
             { ShaderDataType::Float,  "a_TexIndex" },
             { ShaderDataType::Float,  "a_TilingFactor" }
         });
+#endif
         s_Data.QuadVertexArray->AddVertexBuffer(s_Data.QuadVertexBuffer);
         
-        s_Data.QuadVertexBufferBase = new QuadVertex[s_Data.MaxVertices];
-        
         uint32_t* quadIndices = new uint32_t[s_Data.MaxIndices];
         
         uint32_t offset = 0;
@@ -72,8 +675,41 @@ namespace Engine {
         
         Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data.MaxIndices);
         s_Data.QuadVertexArray->SetIndexBuffer(quadIB);
+        s_Data.QuadIndexBuffer = quadIB;
         delete[] quadIndices;
         
+        // Circles share the quad index buffer
+        s_Data.CircleVertexArray = VertexArray::Create();
+        
+        s_Data.CircleVertexBuffer = StreamingVertexBuffer::Create(s_Data.MaxVertices * sizeof(CircleVertex));
+        s_Data.CircleVertexBuffer->SetLayout({
+            { ShaderDataType::Float3, "a_WorldPosition" },
+            { ShaderDataType::Float2, "a_LocalPosition" },
+            { ShaderDataType::Float4, "a_Color" },
+            { ShaderDataType::Float,  "a_Thickness" },
+            { ShaderDataType::Float,  "a_Fade" }
+        });
+        s_Data.CircleVertexArray->AddVertexBuffer(s_Data.CircleVertexBuffer);
+        s_Data.CircleVertexArray->SetIndexBuffer(quadIB);
+        
+        // Texture array quads use the quad vertex format and index buffer
+        s_Data.ArrayVertexArray = VertexArray::Create();
+        
+        s_Data.ArrayVertexBuffer = StreamingVertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
+        s_Data.ArrayVertexBuffer->SetLayout(s_Data.QuadVertexBuffer->GetLayout());
+        s_Data.ArrayVertexArray->AddVertexBuffer(s_Data.ArrayVertexBuffer);
+        s_Data.ArrayVertexArray->SetIndexBuffer(quadIB);
+        
+        // Lines are not indexed
+        s_Data.LineVertexArray = VertexArray::Create();
+        
+        s_Data.LineVertexBuffer = StreamingVertexBuffer::Create(s_Data.MaxLineVertices * sizeof(LineVertex));
+        s_Data.LineVertexBuffer->SetLayout({
+            { ShaderDataType::Float3, "a_Position" },
+            { ShaderDataType::UByte4, "a_Color", true }
+        });
+        s_Data.LineVertexArray->AddVertexBuffer(s_Data.LineVertexBuffer);
+        
         s_Data.WhiteTexture = Texture2D::Create(1, 1);
         uint32_t whiteTextureData = 0xffffffff;
         s_Data.WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
@@ -82,38 +718,258 @@ namespace Engine {
         for (uint32_t i = 0; i < s_Data.MaxTextureSlots; i++)
             samplers[i] = i;
         
-        s_Data.TextureShader = Shader::Create("assets/shaders/Texture.glsl");
+        s_Data.TextureShader = Shader::Create(QuadShaderPath);
         s_Data.TextureShader->Bind();
         s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
         
         s_Data.TextureSlots[0] = s_Data.WhiteTexture;
         
-        s_Data.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-        s_Data.QuadVertexPositions[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
-        s_Data.QuadVertexPositions[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
-        s_Data.QuadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
+        s_Data.CircleShader = Shader::Create("assets/shaders/Circle.glsl");
+        
+        s_Data.LineShader = Shader::Create("assets/shaders/Line.glsl");
+        
+        s_Data.ArrayShader = Shader::Create(ArrayShaderPath);
+        s_Data.ArrayShader->Bind();
+        s_Data.ArrayShader->SetInt("u_TextureArray", 0);
+        
+        // Instanced path: a shared unit quad plus one QuadInstance per quad
+        s_Data.InstanceVertexArray = VertexArray::Create();
+        
+        float unitQuad[] = {
+            -0.5f, -0.5f,
+             0.5f, -0.5f,
+             0.5f,  0.5f,
+            -0.5f,  0.5f
+        };
+        Ref<VertexBuffer> unitQuadVB = VertexBuffer::Create(unitQuad, sizeof(unitQuad));
+        unitQuadVB->SetLayout({
+            { ShaderDataType::Float2, "a_Corner" }
+        });
+        s_Data.InstanceVertexArray->AddVertexBuffer(unitQuadVB);
+        
+        s_Data.InstanceVertexBuffer = VertexBuffer::Create(s_Data.MaxQuads * sizeof(QuadInstance));
+        s_Data.InstanceVertexBuffer->SetLayout({
+            { ShaderDataType::Float3, "i_Position",     false, 1 },
+            { ShaderDataType::Float2, "i_Size",         false, 1 },
+            { ShaderDataType::Float2, "i_Rotation",     false, 1 },
+            { ShaderDataType::Float4, "i_Color",        false, 1 },
+            { ShaderDataType::Float4, "i_TexRect",      false, 1 },
+            { ShaderDataType::Float,  "i_TexIndex",     false, 1 },
+            { ShaderDataType::Float,  "i_TilingFactor", false, 1 }
+        });
+        s_Data.InstanceVertexArray->AddVertexBuffer(s_Data.InstanceVertexBuffer);
+        
+        uint32_t unitQuadIndices[] = { 0, 1, 2, 2, 3, 0 };
+        s_Data.InstanceVertexArray->SetIndexBuffer(IndexBuffer::Create(unitQuadIndices, 6));
+        
+        s_Data.InstanceBufferBase = new QuadInstance[s_Data.MaxQuads];
+        
+        s_Data.InstancedShader = Shader::Create("assets/shaders/TextureInstanced.glsl");
+        s_Data.InstancedShader->Bind();
+        s_Data.InstancedShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
     }
 
     void Renderer2D::Shutdown() {
-        delete[] s_Data.QuadVertexBufferBase;
+        delete[] s_Data.InstanceBufferBase;
+        s_Data.TextCache.clear();
+        s_Data.SortLayers.clear();
+        s_Data.CurrentArray = nullptr;
+        s_Data.Recorders.clear();
     }
 
     void Renderer2D::BeginScene(const OrthographicCamera& camera) {
+        s_Data.InstancedShader->Bind();
+        s_Data.InstancedShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        
         s_Data.TextureShader->Bind();
         s_Data.TextureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
         
+        s_Data.CircleShader->Bind();
+        s_Data.CircleShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        
+        s_Data.ArrayShader->Bind();
+        s_Data.ArrayShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        
+        s_Data.LineShader->Bind();
+        s_Data.LineShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+        
+        camera.GetViewBounds(s_Data.ViewMin, s_Data.ViewMax);
+        s_Data.ViewProjection = camera.GetViewProjectionMatrix();
+        
+        s_Data.QuadCommands.clear();
+        s_Data.SortEntries.clear();
+        s_Data.SortTextures.clear();
+        s_Data.SortTextureLookup.clear();
+        s_Data.SortLayers.clear();
+        s_Data.SortStaticParts.clear();
+        
         StartBatch();
     }
 
     void Renderer2D::EndScene() {
+        if (s_Data.Mode != SubmissionMode::Immediate)
+            SubmitSorted();
+        
+        Flush();
+    }
+
+    void Renderer2D::SubmitSorted() {
+        RadixSortQuads(s_Data.SortEntries, s_Data.SortScratch);
+        
+        const bool layered = s_Data.Mode == SubmissionMode::Layered;
+        const glm::vec2 viewSize = s_Data.ViewMax - s_Data.ViewMin;
+        float coveredArea = 0.0f;
+        bool transparentPass = false;
+        
+        if (layered) {
+            // Quads submitted before EndScene keep the default state
+            NextBatch();
+            RenderCommand::SetBlend(false);
+            RenderCommand::SetDepthLessEqual(true);
+        }
+        
+        // Expand through the immediate path, which owns batching and texture slots
+        s_Data.ReplayingSorted = true;
+        for (const QuadSortEntry& entry : s_Data.SortEntries) {
+            const QuadCommand& cmd = s_Data.QuadCommands[entry.Index];
+            glm::vec3 position = cmd.Position;
+            
+            if (layered && !transparentPass && IsLayeredTransparent(entry.Key)) {
+                // Opaque depth is written; transparent quads test against it but don't
+                // write, so overlapping ones still blend in back-to-front order
+                NextBatch();
+                RenderCommand::SetBlend(true);
+                RenderCommand::SetDepthWrite(false);
+                transparentPass = true;
+            }
+            
+            if (layered) {
+                const glm::vec2 extent = cmd.Circle ? glm::vec2(cmd.Size.x * 2.0f) : glm::abs(cmd.Size);
+                const glm::vec2 pos = glm::vec2(cmd.Position);
+                const glm::vec2 min = glm::max(pos - extent * 0.5f, s_Data.ViewMin);
+                const glm::vec2 max = glm::min(pos + extent * 0.5f, s_Data.ViewMax);
+                if (max.x > min.x && max.y > min.y)
+                    coveredArea += (max.x - min.x) * (max.y - min.y);
+                
+                if (transparentPass)
+                    s_Data.Stats.TransparentQuadCount++;
+                else
+                    s_Data.Stats.OpaqueQuadCount++;
+                
+                // Depth alone can't order layers: a transparent quad at the same z as an
+                // opaque one would fail the test however high its layer
+                position.z += (float)GetLayeredSortLayer(entry.Key) * LayerDepthBias;
+            }
+            
+            if (cmd.StaticIndex >= 0) {
+                const StaticPartCommand& part = s_Data.SortStaticParts[cmd.StaticIndex];
+                NextBatch();
+                const glm::mat4 depthBias = glm::translate(glm::mat4(1.0f), { 0.0f, 0.0f, position.z - cmd.Position.z });
+                DrawStaticPart(part.Batch->Parts[part.Part], depthBias * part.Transform);
+            } else if (cmd.Circle) {
+                DrawCircle(position, cmd.Size.x, cmd.Color, cmd.Thickness, cmd.Fade);
+            } else if (cmd.LayerIndex >= 0) {
+                DrawArrayQuad(position, cmd.Size, cmd.Rotation, cmd.Rotated, s_Data.SortLayers[cmd.LayerIndex],
+                              cmd.TilingFactor, cmd.Color);
+            } else if (cmd.TextureIndex < 0) {
+                if (cmd.Rotated)
+                    DrawRotatedQuad(position, cmd.Size, cmd.Rotation, cmd.Color);
+                else
+                    DrawQuad(position, cmd.Size, cmd.Color);
+            } else {
+                const glm::vec2 texCoords[] = {
+                    { cmd.TexRect.x, cmd.TexRect.y }, { cmd.TexRect.z, cmd.TexRect.y },
+                    { cmd.TexRect.z, cmd.TexRect.w }, { cmd.TexRect.x, cmd.TexRect.w }
+                };
+                DrawTexturedQuad(position, cmd.Size, cmd.Rotation, cmd.Rotated, s_Data.SortTextures[cmd.TextureIndex],
+                                 texCoords, cmd.TilingFactor, cmd.Color);
+            }
+        }
+        s_Data.ReplayingSorted = false;
+        
+        if (layered) {
+            NextBatch();
+            RenderCommand::SetBlend(true);
+            RenderCommand::SetDepthWrite(true);
+            RenderCommand::SetDepthLessEqual(false);
+            
+            if (viewSize.x > 0.0f && viewSize.y > 0.0f)
+                s_Data.Stats.Overdraw += coveredArea / (viewSize.x * viewSize.y);
+        }
+        
+        s_Data.QuadCommands.clear();
+        s_Data.SortEntries.clear();
+        s_Data.SortTextures.clear();
+        s_Data.SortTextureLookup.clear();
+        s_Data.SortLayers.clear();
+        s_Data.SortStaticParts.clear();
+    }
+
+    void Renderer2D::SetSubmissionMode(SubmissionMode mode) {
+        s_Data.Mode = mode;
+    }
+
+    Renderer2D::SubmissionMode Renderer2D::GetSubmissionMode() {
+        return s_Data.Mode;
+    }
+
+    void Renderer2D::SetSortLayer(uint8_t layer) {
+        s_Data.SortLayer = layer;
+    }
+
+    bool Renderer2D::IsVisible(const glm::vec2& center, const glm::vec2& halfExtent) {
+        if (center.x + halfExtent.x < s_Data.ViewMin.x || center.x - halfExtent.x > s_Data.ViewMax.x ||
+            center.y + halfExtent.y < s_Data.ViewMin.y || center.y - halfExtent.y > s_Data.ViewMax.y) {
+            s_Data.Stats.CulledCount++;
+            return false;
+        }
+        
+        return true;
+    }
+
+    void Renderer2D::SetInstancingEnabled(bool enabled) {
+        if (s_Data.Instanced == enabled)
+            return;
+        
+        // Pending quads belong to the old path
         Flush();
+        s_Data.Instanced = enabled;
+        StartBatch();
+    }
+
+    bool Renderer2D::IsInstancingEnabled() {
+        return s_Data.Instanced;
     }
 
     void Renderer2D::StartBatch() {
         s_Data.QuadIndexCount = 0;
+        if (!s_Data.Instanced)
+            s_Data.QuadVertexBufferBase = (QuadVertex*)s_Data.QuadVertexBuffer->BeginWrite();
         s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
         
+        s_Data.CircleIndexCount = 0;
+        s_Data.CircleVertexBufferBase = (CircleVertex*)s_Data.CircleVertexBuffer->BeginWrite();
+        s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBufferBase;
+        
+        s_Data.ArrayIndexCount = 0;
+        s_Data.ArrayVertexBufferBase = (QuadVertex*)s_Data.ArrayVertexBuffer->BeginWrite();
+        s_Data.ArrayVertexBufferPtr = s_Data.ArrayVertexBufferBase;
+        s_Data.CurrentArray = nullptr;
+        
+        s_Data.LineVertexCount = 0;
+        s_Data.LineVertexBufferBase = (LineVertex*)s_Data.LineVertexBuffer->BeginWrite();
+        s_Data.LineVertexBufferPtr = s_Data.LineVertexBufferBase;
+        
+        s_Data.InstanceCount = 0;
+        s_Data.InstanceBufferPtr = s_Data.InstanceBufferBase;
+        
         s_Data.TextureSlotIndex = 1;
+        
+        if (++s_Data.TextureSlotGeneration == 0) {
+            // Wrapped: stale stamps could alias the new generation
+            s_Data.TextureSlotTable.fill({});
+            s_Data.TextureSlotGeneration = 1;
+        }
     }
 
     void Renderer2D::NextBatch() {
@@ -121,18 +977,161 @@ namespace Engine {
         StartBatch();
     }
 
+    void Renderer2D::SwitchPrimitive(BatchPrimitive primitive) {
+        const bool quadsPending = s_Data.QuadIndexCount > 0 || s_Data.InstanceCount > 0;
+        const bool circlesPending = s_Data.CircleIndexCount > 0;
+        const bool arrayQuadsPending = s_Data.ArrayIndexCount > 0;
+        const bool linesPending = s_Data.LineVertexCount > 0;
+        
+        bool otherPending = false;
+        switch (primitive) {
+            case BatchPrimitive::Quad:      otherPending = circlesPending || arrayQuadsPending || linesPending; break;
+            case BatchPrimitive::Circle:    otherPending = quadsPending || arrayQuadsPending || linesPending; break;
+            case BatchPrimitive::ArrayQuad: otherPending = quadsPending || circlesPending || linesPending; break;
+            case BatchPrimitive::Line:      otherPending = quadsPending || circlesPending || arrayQuadsPending; break;
+        }
+        
+        if (otherPending) {
+            NextBatch();
+            s_Data.Stats.PrimitiveSwitches++;
+        }
+    }
+
+    float Renderer2D::GetTextureSlot(const Ref<Texture2D>& texture) {
+        s_Data.Stats.TextureSlotLookups++;
+        
+        const uint32_t rendererID = texture->GetRendererID();
+        const uint32_t mask = Renderer2DData::TextureSlotTableSize - 1;
+        uint32_t bucket = (rendererID * 2654435761u) & mask;
+        
+        while (s_Data.TextureSlotTable[bucket].Generation == s_Data.TextureSlotGeneration) {
+            if (s_Data.TextureSlotTable[bucket].RendererID == rendererID)
+                return (float)s_Data.TextureSlotTable[bucket].Slot;
+            bucket = (bucket + 1) & mask;
+        }
+        
+        if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots) {
+            NextBatch();
+            s_Data.Stats.SlotExhaustionBatchBreaks++;
+            
+            // Table is empty again, so the home bucket is free
+            bucket = (rendererID * 2654435761u) & mask;
+        }
+        
+        uint32_t slot = s_Data.TextureSlotIndex++;
+        s_Data.TextureSlots[slot] = texture;
+        s_Data.TextureSlotTable[bucket] = { rendererID, s_Data.TextureSlotGeneration, slot };
+        return (float)slot;
+    }
+
+    void Renderer2D::SubmitQuadInstance(const glm::vec3& position, const glm::vec2& size, float radians,
+                                        const glm::vec4& color, const Ref<Texture2D>& texture, float tilingFactor,
+                                        const glm::vec4& texRect) {
+        SwitchPrimitive(BatchPrimitive::Quad);
+        if (s_Data.InstanceCount >= Renderer2DData::MaxQuads)
+            NextBatch();
+        
+        float textureIndex = texture ? GetTextureSlot(texture) : 0.0f;
+        
+        QuadInstance& instance = *s_Data.InstanceBufferPtr++;
+        instance.Position = position;
+        instance.Size = size;
+        instance.Rotation = radians == 0.0f ? glm::vec2(1.0f, 0.0f) : glm::vec2(std::cos(radians), std::sin(radians));
+        instance.Color = color;
+        instance.TexRect = texRect;
+        instance.TexIndex = textureIndex;
+        instance.TilingFactor = tilingFactor;
+        
+        s_Data.InstanceCount++;
+        s_Data.Stats.QuadCount++;
+    }
+
     void Renderer2D::Flush() {
+        // SwitchPrimitive keeps at most one batch non-empty, so the order here doesn't
+        // change what ends up on top
+        FlushLines();
+        FlushCircles();
+        FlushArrayQuads();
+        
+        if (s_Data.Instanced) {
+            FlushInstances();
+            return;
+        }
+        
         if (s_Data.QuadIndexCount == 0)
             return; // Nothing to draw
         
         uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
-        s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
+        uint32_t regionOffset = s_Data.QuadVertexBuffer->Commit(dataSize);
         
         // Bind textures
         for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
             s_Data.TextureSlots[i]->Bind(i);
         
-        RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
+        s_Data.TextureShader->Bind();
+        s_Data.QuadVertexArray->Bind();
+        RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount, regionOffset / sizeof(QuadVertex));
+        s_Data.Stats.DrawCalls++;
+    }
+
+    void Renderer2D::FlushCircles() {
+        if (s_Data.CircleIndexCount == 0)
+            return; // Nothing to draw
+        
+        uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.CircleVertexBufferPtr - (uint8_t*)s_Data.CircleVertexBufferBase);
+        uint32_t regionOffset = s_Data.CircleVertexBuffer->Commit(dataSize);
+        
+        s_Data.CircleShader->Bind();
+        s_Data.CircleVertexArray->Bind();
+        RenderCommand::DrawIndexed(s_Data.CircleVertexArray, s_Data.CircleIndexCount, regionOffset / sizeof(CircleVertex));
+        s_Data.Stats.DrawCalls++;
+    }
+
+    void Renderer2D::FlushLines() {
+        if (s_Data.LineVertexCount == 0)
+            return; // Nothing to draw
+        
+        uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.LineVertexBufferPtr - (uint8_t*)s_Data.LineVertexBufferBase);
+        uint32_t regionOffset = s_Data.LineVertexBuffer->Commit(dataSize);
+        
+        s_Data.LineShader->Bind();
+        s_Data.LineVertexArray->Bind();
+        RenderCommand::DrawLines(s_Data.LineVertexArray, s_Data.LineVertexCount, regionOffset / sizeof(LineVertex));
+        s_Data.Stats.DrawCalls++;
+    }
+
+    void Renderer2D::FlushArrayQuads() {
+        if (s_Data.ArrayIndexCount == 0)
+            return; // Nothing to draw
+        
+        uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.ArrayVertexBufferPtr - (uint8_t*)s_Data.ArrayVertexBufferBase);
+        uint32_t regionOffset = s_Data.ArrayVertexBuffer->Commit(dataSize);
+        
+        s_Data.CurrentArray->Bind(0);
+        s_Data.ArrayShader->Bind();
+        s_Data.ArrayVertexArray->Bind();
+        RenderCommand::DrawIndexed(s_Data.ArrayVertexArray, s_Data.ArrayIndexCount, regionOffset / sizeof(QuadVertex));
+        s_Data.Stats.DrawCalls++;
+        
+        // Later quads in this batch write to the next region
+        s_Data.ArrayIndexCount = 0;
+        s_Data.ArrayVertexBufferBase = (QuadVertex*)s_Data.ArrayVertexBuffer->BeginWrite();
+        s_Data.ArrayVertexBufferPtr = s_Data.ArrayVertexBufferBase;
+    }
+
+    void Renderer2D::FlushInstances() {
+        if (s_Data.InstanceCount == 0)
+            return; // Nothing to draw
+        
+        s_Data.InstanceVertexBuffer->SetData(s_Data.InstanceBufferBase, s_Data.InstanceCount * sizeof(QuadInstance));
+        
+        // Bind textures
+        for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
+            s_Data.TextureSlots[i]->Bind(i);
+        
+        s_Data.InstancedShader->Bind();
+        s_Data.InstanceVertexArray->Bind();
+        RenderCommand::DrawIndexedInstanced(s_Data.InstanceVertexArray, 6, s_Data.InstanceCount);
         s_Data.Stats.DrawCalls++;
     }
 
@@ -141,25 +1140,31 @@ namespace Engine {
     }
 
     void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) {
+        if (ShouldRecordQuad()) {
+            RecordQuad(position, size, 0.0f, false, color, nullptr, 1.0f);
+            return;
+        }
+        
+        if (s_Data.Instanced) {
+            SubmitQuadInstance(position, size, 0.0f, color, nullptr, 1.0f);
+            return;
+        }
+        
         constexpr size_t quadVertexCount = 4;
         const float textureIndex = 0.0f; // White Texture
         constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
         const float tilingFactor = 1.0f;
         
+        SwitchPrimitive(BatchPrimitive::Quad);
         if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
             NextBatch();
         
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-            * glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
+        glm::vec3 corners[quadVertexCount];
+        ComputeQuadCorners(position, size, corners);
         
-        for (size_t i = 0; i < quadVertexCount; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-            s_Data.QuadVertexBufferPtr->Color = color;
-            s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-            s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-            s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr++;
-        }
+        const QuadVertexColor vertexColor = EncodeQuadVertexColor(color);
+        for (size_t i = 0; i < quadVertexCount; i++)
+            *s_Data.QuadVertexBufferPtr++ = MakeQuadVertex(corners[i], vertexColor, textureCoords[i], textureIndex, tilingFactor);
         
         s_Data.QuadIndexCount += 6;
         
@@ -171,149 +1176,625 @@ namespace Engine {
     }
 
     void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        DrawTexturedQuad(position, size, 0.0f, false, texture, textureCoords, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        DrawQuad({ position.x, position.y, 0.0f }, size, subTexture, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        DrawTexturedQuad(position, size, 0.0f, false, subTexture->GetTexture(), subTexture->GetTexCoords(), tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, color);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        if (ShouldRecordQuad()) {
+            RecordQuad(position, size, rotation, true, color, nullptr, 1.0f);
+            return;
+        }
+        
+        if (s_Data.Instanced) {
+            SubmitQuadInstance(position, size, glm::radians(rotation), color, nullptr, 1.0f);
+            return;
+        }
+        
         constexpr size_t quadVertexCount = 4;
+        const float textureIndex = 0.0f; // White Texture
         constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        const float tilingFactor = 1.0f;
         
+        SwitchPrimitive(BatchPrimitive::Quad);
         if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
             NextBatch();
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
-            if (*s_Data.TextureSlots[i] == *texture) {
-                textureIndex = (float)i;
-                break;
-            }
+        glm::vec3 corners[quadVertexCount];
+        ComputeRotatedQuadCorners(position, size, glm::radians(rotation), corners);
+        
+        const QuadVertexColor vertexColor = EncodeQuadVertexColor(color);
+        for (size_t i = 0; i < quadVertexCount; i++)
+            *s_Data.QuadVertexBufferPtr++ = MakeQuadVertex(corners[i], vertexColor, textureCoords[i], textureIndex, tilingFactor);
+        
+        s_Data.QuadIndexCount += 6;
+        
+        s_Data.Stats.QuadCount++;
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, texture, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        DrawTexturedQuad(position, size, rotation, true, texture, textureCoords, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, subTexture, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor) {
+        DrawTexturedQuad(position, size, rotation, true, subTexture->GetTexture(), subTexture->GetTexCoords(), tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawTexturedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                                      const Ref<Texture2D>& texture, const glm::vec2* texCoords,
+                                      float tilingFactor, const glm::vec4& tintColor) {
+        const glm::vec4 texRect = { texCoords[0].x, texCoords[0].y, texCoords[2].x, texCoords[2].y };
+        
+        if (ShouldRecordQuad()) {
+            RecordQuad(position, size, rotation, rotated, tintColor, texture, tilingFactor, texRect);
+            return;
         }
         
-        if (textureIndex == 0.0f) {
-            if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-                NextBatch();
-            
-            textureIndex = (float)s_Data.TextureSlotIndex;
-            s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-            s_Data.TextureSlotIndex++;
+        if (s_Data.Instanced) {
+            SubmitQuadInstance(position, size, rotated ? glm::radians(rotation) : 0.0f, tintColor, texture, tilingFactor, texRect);
+            return;
         }
         
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-            * glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
+        constexpr size_t quadVertexCount = 4;
         
-        for (size_t i = 0; i < quadVertexCount; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-            s_Data.QuadVertexBufferPtr->Color = tintColor;
-            s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-            s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-            s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr++;
-        }
+        SwitchPrimitive(BatchPrimitive::Quad);
+        if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+            NextBatch();
+        
+        float textureIndex = GetTextureSlot(texture);
+        
+        glm::vec3 corners[quadVertexCount];
+        if (rotated)
+            ComputeRotatedQuadCorners(position, size, glm::radians(rotation), corners);
+        else
+            ComputeQuadCorners(position, size, corners);
+        
+        const QuadVertexColor vertexColor = EncodeQuadVertexColor(tintColor);
+        for (size_t i = 0; i < quadVertexCount; i++)
+            *s_Data.QuadVertexBufferPtr++ = MakeQuadVertex(corners[i], vertexColor, texCoords[i], textureIndex, tilingFactor);
         
         s_Data.QuadIndexCount += 6;
         
         s_Data.Stats.QuadCount++;
     }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
-        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, color);
+    void Renderer2D::ResetStats() {
+        memset(&s_Data.Stats, 0, sizeof(Statistics));
     }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+    Renderer2D::Statistics Renderer2D::GetStats() {
+        return s_Data.Stats;
+    }
+
+    void Renderer2D::DrawRotatedQuads(const glm::vec3* positions, const glm::vec2* sizes, const float* rotations,
+                                      const glm::vec4* colors, uint32_t count) {
+        if (ShouldRecordQuad()) {
+            for (uint32_t i = 0; i < count; i++)
+                RecordQuad(positions[i], sizes[i], rotations[i], true, colors[i], nullptr, 1.0f);
+            return;
+        }
+        
+        if (s_Data.Instanced) {
+            for (uint32_t i = 0; i < count; i++)
+                SubmitQuadInstance(positions[i], sizes[i], glm::radians(rotations[i]), colors[i], nullptr, 1.0f);
+            return;
+        }
+        
         constexpr size_t quadVertexCount = 4;
         const float textureIndex = 0.0f; // White Texture
         constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
         const float tilingFactor = 1.0f;
         
-        if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
-            NextBatch();
+        s_Data.CornerScratch.resize((size_t)count * quadVertexCount);
+        ComputeRotatedQuadCornersBatch(positions, sizes, rotations, count, s_Data.CornerScratch.data());
         
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-            * glm::rotate(glm::mat4(1.0f), glm::radians(rotation), { 0.0f, 0.0f, 1.0f })
-            * glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-        
-        for (size_t i = 0; i < quadVertexCount; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-            s_Data.QuadVertexBufferPtr->Color = color;
-            s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-            s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-            s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr++;
+        SwitchPrimitive(BatchPrimitive::Quad);
+        const glm::vec3* corners = s_Data.CornerScratch.data();
+        for (uint32_t q = 0; q < count; q++) {
+            if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+                NextBatch();
+            
+            const QuadVertexColor vertexColor = EncodeQuadVertexColor(colors[q]);
+            for (size_t i = 0; i < quadVertexCount; i++)
+                *s_Data.QuadVertexBufferPtr++ = MakeQuadVertex(*corners++, vertexColor, textureCoords[i], textureIndex, tilingFactor);
+            
+            s_Data.QuadIndexCount += 6;
         }
         
-        s_Data.QuadIndexCount += 6;
+        s_Data.Stats.QuadCount += count;
+    }
+
+    void Renderer2D::RecordParallel(uint32_t count, const RecordFunction& generate) {
+        const bool expand = !ShouldRecordQuad() && !s_Data.Instanced;
+        const uint32_t sliceCount = (count + Renderer2DData::RecordSliceSize - 1) / Renderer2DData::RecordSliceSize;
         
-        s_Data.Stats.QuadCount++;
+        while (s_Data.Recorders.size() < sliceCount)
+            s_Data.Recorders.push_back(CreateScope<QuadRecorder>());
+        for (uint32_t slice = 0; slice < sliceCount; slice++)
+            s_Data.Recorders[slice]->m_Storage->Reset(expand);
+        
+        JobSystem::ParallelFor(sliceCount, [&](uint32_t slice) {
+            uint32_t begin = slice * Renderer2DData::RecordSliceSize;
+            uint32_t end = std::min(begin + Renderer2DData::RecordSliceSize, count);
+            generate(begin, end, *s_Data.Recorders[slice]);
+        });
+        
+        for (uint32_t slice = 0; slice < sliceCount; slice++)
+            MergeRecorder(*s_Data.Recorders[slice]);
     }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
-        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, texture, tilingFactor, tintColor);
+    void Renderer2D::MergeRecorder(QuadRecorder& recorder) {
+        QuadRecorder::Storage& storage = *recorder.m_Storage;
+        
+        if (storage.Expand) {
+            constexpr size_t quadVertexCount = 4;
+            QuadVertex* vertices = storage.Vertices.data();
+            const uint32_t quadCount = (uint32_t)storage.QuadTextures.size();
+            
+            if (quadCount > 0)
+                SwitchPrimitive(BatchPrimitive::Quad);
+            
+            // Slots only change when the texture or the batch does
+            int32_t lastTexture = -1;
+            uint32_t lastGeneration = s_Data.TextureSlotGeneration;
+            float textureIndex = 0.0f;
+            
+            // Circles recorded before quad quadIndex, in their place between the quads
+            size_t nextCircle = 0;
+            const auto drawCircles = [&](uint32_t quadIndex) {
+                for (; nextCircle < storage.Circles.size() && storage.Circles[nextCircle].QuadIndex <= quadIndex; nextCircle++) {
+                    const RecordedCircle& circle = storage.Circles[nextCircle];
+                    DrawCircle(circle.Position, circle.Radius, circle.Color, circle.Thickness, circle.Fade);
+                }
+            };
+            
+            for (uint32_t q = 0; q < quadCount; q++) {
+                if (nextCircle < storage.Circles.size() && storage.Circles[nextCircle].QuadIndex == q) {
+                    drawCircles(q);
+                    SwitchPrimitive(BatchPrimitive::Quad);
+                }
+                
+                if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+                    NextBatch();
+                
+                const int32_t texture = storage.QuadTextures[q];
+                if (texture != lastTexture || lastGeneration != s_Data.TextureSlotGeneration) {
+                    textureIndex = texture < 0 ? 0.0f : GetTextureSlot(storage.Textures[texture]);
+                    lastTexture = texture;
+                    lastGeneration = s_Data.TextureSlotGeneration;
+                }
+                
+                // Patch the recorder's copy, the mapped buffer is write-only
+                for (size_t i = 0; i < quadVertexCount; i++)
+                    SetQuadVertexTexIndex(vertices[i], textureIndex);
+                memcpy(s_Data.QuadVertexBufferPtr, vertices, quadVertexCount * sizeof(QuadVertex));
+                s_Data.QuadVertexBufferPtr += quadVertexCount;
+                vertices += quadVertexCount;
+                
+                s_Data.QuadIndexCount += 6;
+            }
+            drawCircles(quadCount);
+            
+            s_Data.Stats.QuadCount += quadCount;
+        } else if (ShouldRecordQuad()) {
+            for (size_t i = 0; i < storage.Commands.size(); i++) {
+                QuadCommand command = storage.Commands[i];
+                if (command.TextureIndex >= 0)
+                    command.TextureIndex = GetSortTextureIndex(storage.Textures[command.TextureIndex]);
+                
+                s_Data.SortEntries.push_back({ storage.Keys[i], (uint32_t)s_Data.QuadCommands.size() });
+                s_Data.QuadCommands.push_back(command);
+            }
+            
+            s_Data.Stats.SortedQuadCount += (uint32_t)storage.Commands.size();
+        } else {
+            for (const QuadCommand& command : storage.Commands) {
+                if (command.Circle) {
+                    DrawCircle(command.Position, command.Size.x, command.Color, command.Thickness, command.Fade);
+                    continue;
+                }
+                
+                const Ref<Texture2D> texture = command.TextureIndex >= 0 ? storage.Textures[command.TextureIndex] : nullptr;
+                SubmitQuadInstance(command.Position, command.Size, command.Rotated ? glm::radians(command.Rotation) : 0.0f,
+                                   command.Color, texture, command.TilingFactor, command.TexRect);
+            }
+        }
+        
+        s_Data.Stats.CulledCount += storage.Culled;
+        
+        // Don't keep textures alive until the recorder is next used
+        storage.Textures.clear();
     }
 
-    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) {
+    Ref<StaticQuadBatch> Renderer2D::BuildStaticBatch(const std::vector<StaticQuad>& quads) {
         constexpr size_t quadVertexCount = 4;
         constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
         
-        if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
-            NextBatch();
+        Ref<StaticQuadBatch> batch = CreateRef<StaticQuadBatch>();
+        
+        std::vector<QuadVertex> vertices;
+        StaticQuadBatchPart part;
+        part.Textures.push_back(s_Data.WhiteTexture);
+        
+        auto finishPart = [&]() {
+            if (vertices.empty())
+                return;
+            
+            Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create((float*)vertices.data(), (uint32_t)(vertices.size() * sizeof(QuadVertex)));
+            vertexBuffer->SetLayout(s_Data.QuadVertexBuffer->GetLayout());
+            
+            part.QuadVertexArray = VertexArray::Create();
+            part.QuadVertexArray->AddVertexBuffer(vertexBuffer);
+            part.QuadVertexArray->SetIndexBuffer(s_Data.QuadIndexBuffer);
+            part.IndexCount = (uint32_t)(vertices.size() / quadVertexCount) * 6;
+            batch->Parts.push_back(part);
+            
+            vertices.clear();
+            part = StaticQuadBatchPart();
+            part.Textures.push_back(s_Data.WhiteTexture);
+        };
         
-        float textureIndex = 0.0f;
-        for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++) {
-            if (*s_Data.TextureSlots[i] == *texture) {
-                textureIndex = (float)i;
-                break;
+        for (const StaticQuad& quad : quads) {
+            const Ref<Texture2D>& texture = quad.SubTexture ? quad.SubTexture->GetTexture() : quad.Texture;
+            const glm::vec2* texCoords = quad.SubTexture ? quad.SubTexture->GetTexCoords() : textureCoords;
+            
+            if (vertices.size() >= Renderer2DData::MaxVertices)
+                finishPart();
+            
+            // Textures are few per part, a linear scan is fine at build time
+            float textureIndex = 0.0f;
+            if (texture) {
+                auto it = std::find_if(part.Textures.begin(), part.Textures.end(), [&](const Ref<Texture2D>& slot) {
+                    return slot->GetRendererID() == texture->GetRendererID();
+                });
+                
+                if (it == part.Textures.end()) {
+                    if (part.Textures.size() >= Renderer2DData::MaxTextureSlots)
+                        finishPart();
+                    part.Textures.push_back(texture);
+                    it = part.Textures.end() - 1;
+                }
+                textureIndex = (float)(it - part.Textures.begin());
             }
+            
+            glm::vec3 corners[quadVertexCount];
+            if (quad.Rotation != 0.0f)
+                ComputeRotatedQuadCorners(quad.Position, quad.Size, glm::radians(quad.Rotation), corners);
+            else
+                ComputeQuadCorners(quad.Position, quad.Size, corners);
+            
+            if (vertices.empty()) {
+                part.BoundsMin = corners[0];
+                part.BoundsMax = corners[0];
+            }
+            for (size_t i = 0; i < quadVertexCount; i++) {
+                part.BoundsMin = glm::min(part.BoundsMin, corners[i]);
+                part.BoundsMax = glm::max(part.BoundsMax, corners[i]);
+            }
+            part.Opaque = part.Opaque && IsOpaqueQuad(quad.Color, texture);
+            
+            const QuadVertexColor vertexColor = EncodeQuadVertexColor(quad.Color);
+            for (size_t i = 0; i < quadVertexCount; i++)
+                vertices.push_back(MakeQuadVertex(corners[i], vertexColor, texCoords[i], textureIndex, quad.TilingFactor));
         }
+        finishPart();
         
-        if (textureIndex == 0.0f) {
-            if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-                NextBatch();
+        return batch;
+    }
+
+    void Renderer2D::DrawStaticBatch(const Ref<StaticQuadBatch>& batch, const glm::mat4& transform) {
+        if (!batch || batch->Parts.empty())
+            return;
+        
+        for (uint32_t p = 0; p < (uint32_t)batch->Parts.size(); p++) {
+            const StaticQuadBatchPart& part = batch->Parts[p];
+            glm::vec3 min, max;
+            GetStaticPartBounds(part, transform, min, max);
+            const glm::vec2 center = (glm::vec2(min) + glm::vec2(max)) * 0.5f;
+            if (!IsVisible(center, glm::vec2(max) - center))
+                continue;
+            
+            if (ShouldRecordQuad()) {
+                // Sorted like a quad at the part's far end, then drawn whole at that point
+                QuadCommand command;
+                command.Position = { center.x, center.y, min.z };
+                command.Size = glm::vec2(max) - glm::vec2(min);
+                command.Rotation = 0.0f;
+                command.Color = glm::vec4(1.0f);
+                command.TilingFactor = 1.0f;
+                command.TextureIndex = -1;
+                command.LayerIndex = -1;
+                command.StaticIndex = (int32_t)s_Data.SortStaticParts.size();
+                command.TexRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+                command.Rotated = false;
+                command.Circle = false;
+                command.Thickness = 0.0f;
+                command.Fade = 0.0f;
+                s_Data.SortStaticParts.push_back({ batch, p, transform });
+                
+                uint64_t key = MakeSubmissionKey(part.Opaque, s_Data.SortLayer, min.z, 3, 0);
+                s_Data.SortEntries.push_back({ key, (uint32_t)s_Data.QuadCommands.size() });
+                s_Data.QuadCommands.push_back(command);
+                continue;
+            }
             
-            textureIndex = (float)s_Data.TextureSlotIndex;
-            s_Data.TextureSlots[s_Data.TextureSlotIndex] = texture;
-            s_Data.TextureSlotIndex++;
+            // Keep draw order with quads submitted before the part
+            NextBatch();
+            DrawStaticPart(part, transform);
+        }
+    }
+
+    static TextCacheEntry& GetTextLayout(const std::string& text, const Ref<Font>& font) {
+        auto fontIt = s_Data.TextCache.find(font.get());
+        if (fontIt != s_Data.TextCache.end()) {
+            auto it = fontIt->second.Strings.find(text);
+            if (it != fontIt->second.Strings.end())
+                return it->second;
         }
         
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-            * glm::rotate(glm::mat4(1.0f), glm::radians(rotation), { 0.0f, 0.0f, 1.0f })
-            * glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
+        if (s_Data.CachedStringCount >= Renderer2DData::MaxCachedStrings) {
+            s_Data.TextCache.clear();
+            s_Data.CachedStringCount = 0;
+        }
+        
+        FontTextCache& fontCache = s_Data.TextCache[font.get()];
+        fontCache.FontRef = font;
+        TextCacheEntry& entry = fontCache.Strings[text];
+        s_Data.CachedStringCount++;
+        s_Data.Stats.TextLayouts++;
+        
+        font->Layout(text, entry.Quads);
+        if (!entry.Quads.empty()) {
+            entry.BoundsMin = entry.Quads[0].Min;
+            entry.BoundsMax = entry.Quads[0].Max;
+            for (const GlyphQuad& quad : entry.Quads) {
+                entry.BoundsMin = glm::min(entry.BoundsMin, quad.Min);
+                entry.BoundsMax = glm::max(entry.BoundsMax, quad.Max);
+            }
+        }
+        return entry;
+    }
+
+    void Renderer2D::DrawString(const std::string& text, const Ref<Font>& font, const glm::vec2& position,
+                                float size, const glm::vec4& color) {
+        DrawString(text, font, { position.x, position.y, 0.0f }, size, color);
+    }
+
+    void Renderer2D::DrawString(const std::string& text, const Ref<Font>& font, const glm::vec3& position,
+                                float size, const glm::vec4& color) {
+        if (text.empty() || !font || !font->IsLoaded())
+            return;
+        
+        TextCacheEntry& entry = GetTextLayout(text, font);
+        if (entry.Quads.empty())
+            return;
+        
+        const glm::vec2 center = glm::vec2(position) + (entry.BoundsMin + entry.BoundsMax) * 0.5f * size;
+        if (!IsVisible(center, (entry.BoundsMax - entry.BoundsMin) * 0.5f * size))
+            return;
+        
+        // Sorted and instanced submission take glyphs one quad at a time
+        if (ShouldRecordQuad() || s_Data.Instanced) {
+            for (const GlyphQuad& quad : entry.Quads) {
+                const glm::vec2 texCoords[] = {
+                    { quad.TexMin.x, quad.TexMin.y }, { quad.TexMax.x, quad.TexMin.y },
+                    { quad.TexMax.x, quad.TexMax.y }, { quad.TexMin.x, quad.TexMax.y }
+                };
+                const glm::vec2 quadCenter = glm::vec2(position) + (quad.Min + quad.Max) * 0.5f * size;
+                DrawTexturedQuad({ quadCenter.x, quadCenter.y, position.z }, (quad.Max - quad.Min) * size, 0.0f, false,
+                                 font->GetAtlas(), texCoords, 1.0f, color);
+            }
+            return;
+        }
+        
+        constexpr size_t quadVertexCount = 4;
+        
+        uint32_t quadCount = (uint32_t)entry.Quads.size();
+        if (quadCount > Renderer2DData::MaxQuads) {
+            GE_CORE_WARN("DrawString: {0} glyphs exceed one batch, text truncated", quadCount);
+            quadCount = Renderer2DData::MaxQuads;
+        }
+        
+        SwitchPrimitive(BatchPrimitive::Quad);
+        if (s_Data.QuadIndexCount + quadCount * 6 > Renderer2DData::MaxIndices)
+            NextBatch();
+        
+        float textureIndex = GetTextureSlot(font->GetAtlas());
+        
+        if (entry.Vertices.empty()) {
+            entry.Vertices.resize((size_t)quadCount * quadVertexCount);
+            QuadVertex* vertex = entry.Vertices.data();
+            const QuadVertexColor white = EncodeQuadVertexColor(glm::vec4(1.0f));
+            for (uint32_t q = 0; q < quadCount; q++) {
+                const GlyphQuad& quad = entry.Quads[q];
+                const glm::vec3 corners[] = {
+                    { quad.Min.x, quad.Min.y, 0.0f }, { quad.Max.x, quad.Min.y, 0.0f },
+                    { quad.Max.x, quad.Max.y, 0.0f }, { quad.Min.x, quad.Max.y, 0.0f }
+                };
+                const glm::vec2 texCoords[] = {
+                    { quad.TexMin.x, quad.TexMin.y }, { quad.TexMax.x, quad.TexMin.y },
+                    { quad.TexMax.x, quad.TexMax.y }, { quad.TexMin.x, quad.TexMax.y }
+                };
+                
+                for (size_t i = 0; i < quadVertexCount; i++)
+                    *vertex++ = MakeQuadVertex(corners[i], white, texCoords[i], 0.0f, 1.0f);
+            }
+        }
+        
+        // Placement, color and slot are applied on the way into the batch, so moving or
+        // recoloring a string never lays it out again
+        const QuadVertexColor vertexColor = EncodeQuadVertexColor(color);
+        for (const QuadVertex& local : entry.Vertices) {
+            QuadVertex vertex = local;
+            vertex.Position = { position.x + local.Position.x * size, position.y + local.Position.y * size, position.z };
+            vertex.Color = vertexColor;
+            SetQuadVertexTexIndex(vertex, textureIndex);
+            *s_Data.QuadVertexBufferPtr++ = vertex;
+        }
+        s_Data.QuadIndexCount += quadCount * 6;
+        
+        s_Data.Stats.QuadCount += quadCount;
+    }
+
+    void Renderer2D::DrawCircle(const glm::vec2& position, float radius, const glm::vec4& color, float thickness, float fade) {
+        DrawCircle({ position.x, position.y, 0.0f }, radius, color, thickness, fade);
+    }
+
+    void Renderer2D::DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color, float thickness, float fade) {
+        if (ShouldRecordQuad()) {
+            RecordCircle(position, radius, color, thickness, fade);
+            return;
+        }
+        
+        constexpr size_t quadVertexCount = 4;
+        constexpr glm::vec2 localPositions[] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+        
+        SwitchPrimitive(BatchPrimitive::Circle);
+        if (s_Data.CircleIndexCount >= Renderer2DData::MaxIndices)
+            NextBatch();
+        
+        glm::vec3 corners[quadVertexCount];
+        ComputeQuadCorners(position, { radius * 2.0f, radius * 2.0f }, corners);
         
         for (size_t i = 0; i < quadVertexCount; i++) {
-            s_Data.QuadVertexBufferPtr->Position = transform * s_Data.QuadVertexPositions[i];
-            s_Data.QuadVertexBufferPtr->Color = tintColor;
-            s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
-            s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
-            s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-            s_Data.QuadVertexBufferPtr++;
+            s_Data.CircleVertexBufferPtr->WorldPosition = corners[i];
+            s_Data.CircleVertexBufferPtr->LocalPosition = localPositions[i];
+            s_Data.CircleVertexBufferPtr->Color = color;
+            s_Data.CircleVertexBufferPtr->Thickness = thickness;
+            s_Data.CircleVertexBufferPtr->Fade = fade;
+            s_Data.CircleVertexBufferPtr++;
         }
         
-        s_Data.QuadIndexCount += 6;
+        s_Data.CircleIndexCount += 6;
         
-        s_Data.Stats.QuadCount++;
+        s_Data.Stats.CircleCount++;
     }
 
-    void Renderer2D::ResetStats() {
-        memset(&s_Data.Stats, 0, sizeof(Statistics));
+    void Renderer2D::DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& color) {
+        SwitchPrimitive(BatchPrimitive::Line);
+        if (s_Data.LineVertexCount + 2 > Renderer2DData::MaxLineVertices)
+            NextBatch();
+        
+        const uint32_t packedColor = PackColorRGBA8(color);
+        *s_Data.LineVertexBufferPtr++ = { p0, packedColor };
+        *s_Data.LineVertexBufferPtr++ = { p1, packedColor };
+        s_Data.LineVertexCount += 2;
+        
+        s_Data.Stats.LineCount++;
     }
 
-    Renderer2D::Statistics Renderer2D::GetStats() {
-        return s_Data.Stats;
+    void Renderer2D::DrawRect(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) {
+        glm::vec3 corners[4];
+        ComputeQuadCorners(position, size, corners);
+        DrawPolygon(corners, 4, color);
     }
 
-    void Renderer2D::DrawCircle(const glm::vec2& position, float radius, const glm::vec4& color) {
-        DrawCircle({ position.x, position.y, 0.0f }, radius, color);
+    void Renderer2D::DrawRotatedRect(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) {
+        glm::vec3 corners[4];
+        ComputeRotatedQuadCorners(position, size, glm::radians(rotation), corners);
+        DrawPolygon(corners, 4, color);
     }
 
-    void Renderer2D::DrawCircle(const glm::vec3& position, float radius, const glm::vec4& color) {
-        // Draw as octagon (8-sided polygon approximation)
-        const int segments = 8;
-        const float segmentSize = radius * 0.4f;
+    void Renderer2D::DrawPolygon(const glm::vec3* points, uint32_t count, const glm::vec4& color) {
+        if (count < 2)
+            return;
         
-        for (int i = 0; i < segments; i++) {
-            float angle = (360.0f / segments) * i;
-            float rad = glm::radians(angle);
-            float x = position.x + radius * 0.7f * std::cos(rad);
-            float y = position.y + radius * 0.7f * std::sin(rad);
-            
-            DrawRotatedQuad({ x, y, position.z }, { segmentSize, segmentSize }, angle, color);
+        // Keep the outline in one batch so it is never split across a flush
+        const uint32_t vertexCount = count * 2;
+        if (vertexCount > Renderer2DData::MaxLineVertices) {
+            GE_CORE_WARN("DrawPolygon: {0} points exceed one line batch, outline skipped", count);
+            return;
         }
+        
+        SwitchPrimitive(BatchPrimitive::Line);
+        if (s_Data.LineVertexCount + vertexCount > Renderer2DData::MaxLineVertices)
+            NextBatch();
+        
+        const uint32_t packedColor = PackColorRGBA8(color);
+        for (uint32_t i = 0; i < count; i++) {
+            *s_Data.LineVertexBufferPtr++ = { points[i], packedColor };
+            *s_Data.LineVertexBufferPtr++ = { points[(i + 1) % count], packedColor };
+        }
+        s_Data.LineVertexCount += vertexCount;
+        
+        s_Data.Stats.LineCount += count;
     }
 
-}
+    void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor) {
+        DrawQuad({ position.x, position.y, 0.0f }, size, layer, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor) {
+        DrawArrayQuad(position, size, 0.0f, false, layer, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor) {
+        DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, layer, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor) {
+        DrawArrayQuad(position, size, rotation, true, layer, tilingFactor, tintColor);
+    }
 
+    void Renderer2D::DrawArrayQuad(const glm::vec3& position, const glm::vec2& size, float rotation, bool rotated,
+                                   const Ref<TextureLayer>& layer, float tilingFactor, const glm::vec4& tintColor) {
+        if (ShouldRecordQuad()) {
+            RecordArrayQuad(position, size, rotation, rotated, tintColor, layer, tilingFactor);
+            return;
+        }
+        
+        constexpr size_t quadVertexCount = 4;
+        constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+        
+        SwitchPrimitive(BatchPrimitive::ArrayQuad);
+        if (s_Data.ArrayIndexCount >= Renderer2DData::MaxIndices)
+            NextBatch();
+        
+        const Ref<Texture2DArray>& array = layer->GetArray();
+        if (s_Data.CurrentArray != array) {
+            if (s_Data.ArrayIndexCount > 0) {
+                FlushArrayQuads();
+                s_Data.Stats.TextureArraySwitches++;
+            }
+            s_Data.CurrentArray = array;
+        }
+        
+        const float layerIndex = (float)layer->GetLayer();
+        
+        glm::vec3 corners[quadVertexCount];
+        if (rotated)
+            ComputeRotatedQuadCorners(position, size, glm::radians(rotation), corners);
+        else
+            ComputeQuadCorners(position, size, corners);
+        
+        const QuadVertexColor vertexColor = EncodeQuadVertexColor(tintColor);
+        for (size_t i = 0; i < quadVertexCount; i++)
+            *s_Data.ArrayVertexBufferPtr++ = MakeQuadVertex(corners[i], vertexColor, textureCoords[i], layerIndex, tilingFactor);
+        
+        s_Data.ArrayIndexCount += 6;
+        
+        s_Data.Stats.QuadCount++;
+    }
+
+}
@@ -1,6 +1,7 @@
 #include "Engine/Renderer/RendererAPI.h"
 #include "Engine/Core/Logger.h"
 #include "../Platform/OpenGL/OpenGLRendererAPI.h"
+#include "../Platform/Null/NullRendererAPI.h"
 
 namespace Engine {
 
@@ -10,6 +11,7 @@ namespace Engine {
         switch (s_API) {
             case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
             case RendererAPI::API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
+            case RendererAPI::API::Null:    return CreateScope<NullRendererAPI>();
         }
         
         GE_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -0,0 +1,78 @@
+#include "Engine/Renderer/Texture.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Renderer/TextureUploadQueue.h"
+#include "Engine/Core/Logger.h"
+#include "../Platform/OpenGL/OpenGLTexture.h"
+#include "../Platform/Null/NullTexture.h"
+
+namespace Engine {
+
+    const char* ImageFormatToString(ImageFormat format) {
+        switch (format) {
+            case ImageFormat::None:     return "None";
+            case ImageFormat::RGB8:     return "RGB8";
+            case ImageFormat::RGBA8:    return "RGBA8";
+            case ImageFormat::BC1:      return "BC1";
+            case ImageFormat::BC3:      return "BC3";
+            case ImageFormat::BC7:      return "BC7";
+        }
+        return "Unknown";
+    }
+
+    uint64_t GetImageFormatSize(ImageFormat format, uint32_t width, uint32_t height, uint32_t mipCount) {
+        uint64_t size = 0;
+        for (uint32_t level = 0; level < mipCount; level++) {
+            uint64_t w = std::max(width >> level, 1u);
+            uint64_t h = std::max(height >> level, 1u);
+            
+            switch (format) {
+                case ImageFormat::None:     break;
+                case ImageFormat::RGB8:     size += w * h * 3; break;
+                case ImageFormat::RGBA8:    size += w * h * 4; break;
+                // Block formats store 4x4 texel blocks, partial blocks are padded
+                case ImageFormat::BC1:      size += ((w + 3) / 4) * ((h + 3) / 4) * 8; break;
+                case ImageFormat::BC3:
+                case ImageFormat::BC7:      size += ((w + 3) / 4) * ((h + 3) / 4) * 16; break;
+            }
+        }
+        return size;
+    }
+
+    Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(width, height);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(width, height);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<Texture2D> Texture2D::Create(const std::string& path, const TextureSpecification& specification) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path, specification);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(path, specification);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+    Ref<Texture2D> Texture2D::CreateAsync(const std::string& path, const TextureSpecification& specification) {
+        return TextureUploadQueue::Load(path, specification);
+    }
+
+    Ref<Texture2DArray> Texture2DArray::Create(uint32_t width, uint32_t height, uint32_t layers) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2DArray>(width, height, layers);
+            case RendererAPI::API::Null:    return CreateRef<NullTexture2DArray>(width, height, layers);
+        }
+        
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,71 @@
+#include "Engine/Renderer/TextureArrayAllocator.h"
+#include "Engine/Core/Logger.h"
+
+#include <stb_image.h>
+
+namespace Engine {
+
+    TextureArrayAllocator::TextureArrayAllocator(uint64_t arrayBudget)
+        : m_ArrayBudget(arrayBudget) {
+    }
+
+    Ref<TextureLayer> TextureArrayAllocator::Add(const std::string& path) {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(1);
+        stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+
+        if (!data) {
+            GE_CORE_ERROR("Failed to load texture: {0}", path);
+            return nullptr;
+        }
+
+        Ref<TextureLayer> layer = Add(data, (uint32_t)width, (uint32_t)height);
+        stbi_image_free(data);
+        return layer;
+    }
+
+    Ref<TextureLayer> TextureArrayAllocator::Add(const void* pixels, uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) {
+            GE_CORE_ERROR("Cannot add an empty {0}x{1} image to a texture array", width, height);
+            return nullptr;
+        }
+
+        std::vector<Ref<TextureArrayPool>>& pools = m_Pools[((uint64_t)width << 32) | height];
+
+        Ref<TextureArrayPool> target;
+        for (const Ref<TextureArrayPool>& pool : pools) {
+            if (!pool->FreeLayers.empty() || pool->NextLayer < pool->Array->GetLayerCount()) {
+                target = pool;
+                break;
+            }
+        }
+
+        if (!target) {
+            const uint64_t layerBytes = (uint64_t)width * height * 4;
+            const uint32_t layers = (uint32_t)std::clamp<uint64_t>(m_ArrayBudget / layerBytes, 1, Texture2DArray::MaxLayers);
+
+            target = CreateRef<TextureArrayPool>();
+            target->Array = Texture2DArray::Create(width, height, layers);
+            pools.push_back(target);
+        }
+
+        uint32_t layer;
+        if (!target->FreeLayers.empty()) {
+            layer = target->FreeLayers.back();
+            target->FreeLayers.pop_back();
+        } else {
+            layer = target->NextLayer++;
+        }
+
+        target->Array->SetLayerData(layer, pixels);
+        return CreateRef<TextureLayer>(target, layer);
+    }
+
+    uint32_t TextureArrayAllocator::GetArrayCount() const {
+        uint32_t count = 0;
+        for (const auto& [size, pools] : m_Pools)
+            count += (uint32_t)pools.size();
+        return count;
+    }
+
+}
@@ -0,0 +1,144 @@
+#include "Engine/Renderer/TextureAtlas.h"
+#include "Engine/Core/Logger.h"
+
+#include <stb_image.h>
+#include <limits>
+
+namespace Engine {
+
+    TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+        : m_PageSize(pageSize), m_Padding(padding) {
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const std::string& path) {
+        int width, height, channels;
+        stbi_set_flip_vertically_on_load(1);
+        stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+
+        if (!data) {
+            GE_CORE_ERROR("Failed to load texture: {0}", path);
+            return nullptr;
+        }
+
+        Ref<SubTexture2D> subTexture = Add(data, (uint32_t)width, (uint32_t)height);
+        stbi_image_free(data);
+        return subTexture;
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const void* pixels, uint32_t width, uint32_t height) {
+        // Padding goes on the right and top edges so neighbours don't bleed under filtering
+        const uint32_t paddedWidth = width + m_Padding;
+        const uint32_t paddedHeight = height + m_Padding;
+
+        if (paddedWidth > m_PageSize || paddedHeight > m_PageSize) {
+            GE_CORE_ERROR("Image {0}x{1} does not fit a {2}x{2} atlas page", width, height, m_PageSize);
+            return nullptr;
+        }
+
+        uint32_t x = 0, y = 0;
+        size_t node = 0;
+        size_t pageIndex = 0;
+        for (; pageIndex < m_Pages.size(); pageIndex++) {
+            if (FindPosition(m_Pages[pageIndex], paddedWidth, paddedHeight, x, y, node))
+                break;
+        }
+
+        if (pageIndex == m_Pages.size()) {
+            Page page;
+            page.Skyline.push_back({ 0, 0, m_PageSize });
+            m_Pages.push_back(page);
+
+            Ref<Texture2D> texture = Texture2D::Create(m_PageSize, m_PageSize);
+            std::vector<uint32_t> clear((size_t)m_PageSize * m_PageSize, 0);
+            texture->SetData(clear.data(), (uint32_t)(clear.size() * sizeof(uint32_t)));
+            m_PageTextures.push_back(texture);
+
+            FindPosition(m_Pages[pageIndex], paddedWidth, paddedHeight, x, y, node);
+        }
+
+        Insert(m_Pages[pageIndex], node, x, y, paddedWidth, paddedHeight);
+
+        const Ref<Texture2D>& texture = m_PageTextures[pageIndex];
+        texture->SetSubData(const_cast<void*>(pixels), x, y, width, height);
+
+        const float size = (float)m_PageSize;
+        return CreateRef<SubTexture2D>(texture,
+            glm::vec2{ x / size, y / size },
+            glm::vec2{ (x + width) / size, (y + height) / size });
+    }
+
+    // Bottom-left rule: lowest resulting top edge, ties broken by the narrower node
+    bool TextureAtlas::FindPosition(const Page& page, uint32_t width, uint32_t height,
+                                    uint32_t& outX, uint32_t& outY, size_t& outNode) const {
+        const std::vector<SkylineNode>& skyline = page.Skyline;
+        uint32_t bestTop = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+        bool found = false;
+
+        for (size_t i = 0; i < skyline.size(); i++) {
+            const uint32_t x = skyline[i].X;
+            if (x + width > m_PageSize)
+                break;
+
+            // Rest on the highest node the rectangle spans
+            uint32_t y = 0;
+            uint32_t covered = 0;
+            bool fits = true;
+            for (size_t j = i; covered < width; j++) {
+                y = std::max(y, skyline[j].Y);
+                if (y + height > m_PageSize) {
+                    fits = false;
+                    break;
+                }
+                covered += skyline[j].Width;
+            }
+
+            if (!fits)
+                continue;
+
+            if (y + height < bestTop || (y + height == bestTop && skyline[i].Width < bestWidth)) {
+                bestTop = y + height;
+                bestWidth = skyline[i].Width;
+                outX = x;
+                outY = y;
+                outNode = i;
+                found = true;
+            }
+        }
+
+        return found;
+    }
+
+    void TextureAtlas::Insert(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        std::vector<SkylineNode>& skyline = page.Skyline;
+        skyline.insert(skyline.begin() + node, { x, y + height, width });
+
+        // Trim the nodes now hidden under the new one
+        for (size_t i = node + 1; i < skyline.size();) {
+            const uint32_t previousEnd = skyline[i - 1].X + skyline[i - 1].Width;
+            if (skyline[i].X >= previousEnd)
+                break;
+
+            const uint32_t shrink = previousEnd - skyline[i].X;
+            if (skyline[i].Width <= shrink) {
+                skyline.erase(skyline.begin() + i);
+                continue;
+            }
+
+            skyline[i].X += shrink;
+            skyline[i].Width -= shrink;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].Y == skyline[i + 1].Y) {
+                skyline[i].Width += skyline[i + 1].Width;
+                skyline.erase(skyline.begin() + i + 1);
+            } else {
+                i++;
+            }
+        }
+    }
+
+}
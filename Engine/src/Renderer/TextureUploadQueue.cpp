@@ -0,0 +1,205 @@
+#include "Engine/Renderer/TextureUploadQueue.h"
+#include "Engine/Renderer/RendererAPI.h"
+#include "Engine/Renderer/CompressedImage.h"
+#include "Engine/Core/Logger.h"
+#include "../Platform/OpenGL/OpenGLTextureUploader.h"
+#include "../Platform/Null/NullTextureUploader.h"
+
+#include <stb_image.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine {
+
+    // Workers only see the raw pointer as a key; the Ref stays on the render thread so
+    // a texture is never destroyed, and GL never touched, off that thread
+    struct TextureLoadJob {
+        Texture2D* Texture;
+        std::string Path;
+    };
+
+    struct DecodedTexture {
+        Texture2D* Texture;
+        std::string Path;
+        stbi_uc* Pixels;     // nullptr if decoding failed
+        uint32_t Width, Height;
+        uint32_t Channels;   // 3 or 4
+    };
+
+    struct PendingTexture {
+        Ref<Texture2D> Texture;
+        TextureSpecification Specification;
+    };
+
+    struct TextureUploadQueueData {
+        Scope<TextureUploader> Uploader;
+        std::vector<std::thread> Workers;
+
+        // Shared with the workers
+        std::mutex Mutex;
+        std::condition_variable JobAvailable;
+        std::deque<TextureLoadJob> Jobs;
+        std::deque<DecodedTexture> Decoded;
+        bool Stopping = false;
+
+        // Render thread only
+        std::unordered_map<Texture2D*, PendingTexture> Pending;
+        std::deque<DecodedTexture> Ready;
+    };
+
+    static TextureUploadQueueData s_Data;
+
+    static void DecodeWorker() {
+        // The global flag would race with loads on the render thread
+        stbi_set_flip_vertically_on_load_thread(1);
+
+        while (true) {
+            TextureLoadJob job;
+            {
+                std::unique_lock<std::mutex> lock(s_Data.Mutex);
+                s_Data.JobAvailable.wait(lock, [] { return s_Data.Stopping || !s_Data.Jobs.empty(); });
+                if (s_Data.Stopping)
+                    return;
+
+                job = std::move(s_Data.Jobs.front());
+                s_Data.Jobs.pop_front();
+            }
+
+            // RGB images stay RGB like the synchronous loader; anything else becomes RGBA
+            int width = 0, height = 0, channels = 0;
+            stbi_info(job.Path.c_str(), &width, &height, &channels);
+            const int desiredChannels = channels == 3 ? 3 : 4;
+            stbi_uc* pixels = stbi_load(job.Path.c_str(), &width, &height, &channels, desiredChannels);
+
+            std::lock_guard<std::mutex> lock(s_Data.Mutex);
+            s_Data.Decoded.push_back({ job.Texture, std::move(job.Path), pixels, (uint32_t)width, (uint32_t)height, (uint32_t)desiredChannels });
+        }
+    }
+
+    void TextureUploadQueue::Init(uint32_t workerCount, uint32_t stagingSize) {
+        s_Data.Uploader = TextureUploader::Create(stagingSize);
+        s_Data.Stopping = false;
+
+        workerCount = std::max(workerCount, 1u);
+        for (uint32_t i = 0; i < workerCount; i++)
+            s_Data.Workers.emplace_back(DecodeWorker);
+    }
+
+    void TextureUploadQueue::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(s_Data.Mutex);
+            s_Data.Stopping = true;
+        }
+        s_Data.JobAvailable.notify_all();
+
+        for (std::thread& worker : s_Data.Workers)
+            worker.join();
+        s_Data.Workers.clear();
+
+        for (DecodedTexture& decoded : s_Data.Decoded)
+            stbi_image_free(decoded.Pixels);
+        for (DecodedTexture& decoded : s_Data.Ready)
+            stbi_image_free(decoded.Pixels);
+
+        s_Data.Jobs.clear();
+        s_Data.Decoded.clear();
+        s_Data.Ready.clear();
+        s_Data.Pending.clear();
+        s_Data.Uploader.reset();
+    }
+
+    Ref<Texture2D> TextureUploadQueue::Load(const std::string& path, const TextureSpecification& specification) {
+        // Cooked files are small and already in their GPU format, nothing to decode
+        if (!s_Data.Uploader || CompressedImage::IsCompressedPath(path))
+            return Texture2D::Create(path, specification);
+
+        Ref<Texture2D> texture = s_Data.Uploader->CreatePlaceholder(path);
+        s_Data.Pending[texture.get()] = { texture, specification };
+
+        {
+            std::lock_guard<std::mutex> lock(s_Data.Mutex);
+            s_Data.Jobs.push_back({ texture.get(), path });
+        }
+        s_Data.JobAvailable.notify_one();
+
+        return texture;
+    }
+
+    void TextureUploadQueue::Process(uint64_t byteBudget) {
+        if (!s_Data.Uploader)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_Data.Mutex);
+            while (!s_Data.Decoded.empty()) {
+                s_Data.Ready.push_back(std::move(s_Data.Decoded.front()));
+                s_Data.Decoded.pop_front();
+            }
+        }
+
+        if (s_Data.Ready.empty())
+            return;
+
+        s_Data.Uploader->BeginFrame();
+
+        uint64_t spent = 0;
+        while (!s_Data.Ready.empty()) {
+            DecodedTexture& decoded = s_Data.Ready.front();
+            auto it = s_Data.Pending.find(decoded.Texture);
+
+            // No longer pending, there is nothing to upload into
+            if (it == s_Data.Pending.end()) {
+                stbi_image_free(decoded.Pixels);
+                s_Data.Ready.pop_front();
+                continue;
+            }
+
+            // Nobody else holds the texture any more, don't bother uploading it
+            if (it->second.Texture.use_count() == 1) {
+                stbi_image_free(decoded.Pixels);
+                s_Data.Pending.erase(it);
+                s_Data.Ready.pop_front();
+                continue;
+            }
+
+            if (!decoded.Pixels) {
+                GE_CORE_ERROR("Failed to load texture: {0}", decoded.Path);
+                s_Data.Uploader->Fail(it->second.Texture);
+            } else {
+                uint64_t size = (uint64_t)decoded.Width * decoded.Height * decoded.Channels;
+                if (spent > 0 && spent + size > byteBudget)
+                    break;
+                const PendingTexture& pending = it->second;
+                if (!s_Data.Uploader->Upload(pending.Texture, decoded.Pixels, decoded.Width, decoded.Height, decoded.Channels,
+                                             pending.Specification))
+                    break;
+
+                spent += size;
+                stbi_image_free(decoded.Pixels);
+            }
+
+            s_Data.Pending.erase(it);
+            s_Data.Ready.pop_front();
+        }
+    }
+
+    uint32_t TextureUploadQueue::GetPendingCount() {
+        return (uint32_t)s_Data.Pending.size();
+    }
+
+    Scope<TextureUploader> TextureUploader::Create(uint32_t stagingSize) {
+        switch (RendererAPI::GetAPI()) {
+            case RendererAPI::API::None:    GE_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+            case RendererAPI::API::OpenGL:  return CreateScope<OpenGLTextureUploader>(stagingSize);
+            case RendererAPI::API::Null:    return CreateScope<NullTextureUploader>();
+        }
+
+        GE_CORE_ASSERT(false, "Unknown RendererAPI!");
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,144 @@
+#include "Engine/Renderer/Tilemap.h"
+#include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Core/Logger.h"
+
+namespace Engine {
+
+    Tilemap::Tilemap(uint32_t width, uint32_t height) {
+        Resize(width, height);
+    }
+
+    void Tilemap::Resize(uint32_t width, uint32_t height) {
+        std::vector<int32_t> tiles((size_t)width * height, EmptyTile);
+        for (uint32_t y = 0; y < std::min(height, m_Height); y++) {
+            for (uint32_t x = 0; x < std::min(width, m_Width); x++)
+                tiles[(size_t)y * width + x] = m_Tiles[(size_t)y * m_Width + x];
+        }
+
+        m_Width = width;
+        m_Height = height;
+        m_Tiles = std::move(tiles);
+
+        m_ChunksX = (width + ChunkSize - 1) / ChunkSize;
+        m_ChunksY = (height + ChunkSize - 1) / ChunkSize;
+        m_Chunks.assign((size_t)m_ChunksX * m_ChunksY, Chunk());
+    }
+
+    void Tilemap::SetTile(uint32_t x, uint32_t y, int32_t tile) {
+        GE_CORE_ASSERT(x < m_Width && y < m_Height, "Tile coordinates out of range!");
+
+        int32_t& current = m_Tiles[(size_t)y * m_Width + x];
+        if (current == tile)
+            return;
+
+        current = tile;
+        m_Chunks[(size_t)(y / ChunkSize) * m_ChunksX + x / ChunkSize].Dirty = true;
+    }
+
+    int32_t Tilemap::GetTile(uint32_t x, uint32_t y) const {
+        GE_CORE_ASSERT(x < m_Width && y < m_Height, "Tile coordinates out of range!");
+        return m_Tiles[(size_t)y * m_Width + x];
+    }
+
+    void Tilemap::SetTiles(const std::vector<int32_t>& tiles) {
+        if (tiles.size() != (size_t)m_Width * m_Height) {
+            GE_CORE_ERROR("Tilemap expects {0} tiles, got {1}", (size_t)m_Width * m_Height, tiles.size());
+            return;
+        }
+
+        m_Tiles = tiles;
+        InvalidateChunks();
+    }
+
+    void Tilemap::SetTileset(const Ref<Texture2D>& texture, const glm::vec2& cellSize) {
+        m_Tileset = texture;
+        m_CellSize = cellSize;
+        m_TileSubTextures.clear();
+
+        if (texture && cellSize.x > 0.0f && cellSize.y > 0.0f) {
+            uint32_t columns = (uint32_t)(texture->GetWidth() / cellSize.x);
+            uint32_t rows = (uint32_t)(texture->GetHeight() / cellSize.y);
+            m_TileSubTextures.reserve((size_t)columns * rows);
+            for (uint32_t row = 0; row < rows; row++) {
+                for (uint32_t column = 0; column < columns; column++)
+                    m_TileSubTextures.push_back(SubTexture2D::CreateFromCoords(texture, { column, row }, cellSize));
+            }
+        }
+
+        InvalidateChunks();
+    }
+
+    void Tilemap::SetTileSize(float size) {
+        m_TileSize = size;
+        InvalidateChunks();
+    }
+
+    void Tilemap::InvalidateChunks() {
+        for (Chunk& chunk : m_Chunks)
+            chunk.Dirty = true;
+    }
+
+    void Tilemap::OnRender(const glm::mat4& transform) {
+        if (m_TileSubTextures.empty())
+            return;
+
+        const float chunkLocalSize = ChunkSize * m_TileSize;
+
+        for (uint32_t chunkY = 0; chunkY < m_ChunksY; chunkY++) {
+            for (uint32_t chunkX = 0; chunkX < m_ChunksX; chunkX++) {
+                // Tile centres sit on the grid, so chunk edges are half a tile below them.
+                // Cull by the world bounds of the chunk's corners.
+                const glm::vec2 localMin = {
+                    (chunkX * ChunkSize - 0.5f) * m_TileSize,
+                    (chunkY * ChunkSize - 0.5f) * m_TileSize
+                };
+                glm::vec2 min, max;
+                for (uint32_t i = 0; i < 4; i++) {
+                    const glm::vec4 corner = {
+                        localMin.x + ((i & 1) ? chunkLocalSize : 0.0f),
+                        localMin.y + ((i & 2) ? chunkLocalSize : 0.0f),
+                        0.0f, 1.0f
+                    };
+                    const glm::vec2 world = glm::vec2(transform * corner);
+                    min = i == 0 ? world : glm::min(min, world);
+                    max = i == 0 ? world : glm::max(max, world);
+                }
+
+                const glm::vec2 center = (min + max) * 0.5f;
+                if (!Renderer2D::IsVisible(center, max - center))
+                    continue;
+
+                Chunk& chunk = m_Chunks[(size_t)chunkY * m_ChunksX + chunkX];
+                if (chunk.Dirty)
+                    BuildChunk(chunkX, chunkY);
+
+                Renderer2D::DrawStaticBatch(chunk.Batch, transform);
+            }
+        }
+    }
+
+    void Tilemap::BuildChunk(uint32_t chunkX, uint32_t chunkY) {
+        std::vector<Renderer2D::StaticQuad> quads;
+
+        const uint32_t endX = std::min((chunkX + 1) * ChunkSize, m_Width);
+        const uint32_t endY = std::min((chunkY + 1) * ChunkSize, m_Height);
+        for (uint32_t y = chunkY * ChunkSize; y < endY; y++) {
+            for (uint32_t x = chunkX * ChunkSize; x < endX; x++) {
+                int32_t tile = m_Tiles[(size_t)y * m_Width + x];
+                if (tile < 0 || tile >= (int32_t)m_TileSubTextures.size())
+                    continue;
+
+                Renderer2D::StaticQuad quad;
+                quad.Position = { x * m_TileSize, y * m_TileSize, 0.0f };
+                quad.Size = { m_TileSize, m_TileSize };
+                quad.SubTexture = m_TileSubTextures[tile];
+                quads.push_back(quad);
+            }
+        }
+
+        Chunk& chunk = m_Chunks[(size_t)chunkY * m_ChunksX + chunkX];
+        chunk.Batch = Renderer2D::BuildStaticBatch(quads);
+        chunk.Dirty = false;
+    }
+
+}
@@ -1,6 +1,7 @@
 #include "Engine/Scene/Scene.h"
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Components.h"
+#include "Engine/Physics/Physics2D.h"
 #include "Engine/Core/Logger.h"
 #include <box2d/box2d.h>
 
@@ -20,11 +21,17 @@ namespace Engine {
     void Scene::OnPhysics2DStart() {
         b2World* world = static_cast<b2World*>(m_PhysicsWorld);
         
+        // Raycasts and debug drawing go to the running scene's world
+        Physics2D::SetWorld(m_PhysicsWorld);
+        
+        // Bodies are placed in world space
+        UpdateWorldTransforms();
+        
         // Create Box2D bodies for all entities with Rigidbody2D component
-        auto view = m_Registry.view<TransformComponent, Rigidbody2DComponent>();
+        auto view = m_Registry.view<WorldTransformComponent, Rigidbody2DComponent>();
         for (auto e : view) {
             Entity entity = { e, this };
-            auto& transform = entity.GetComponent<TransformComponent>();
+            auto& transform = entity.GetComponent<WorldTransformComponent>();
             auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
             
             b2BodyDef bodyDef;
@@ -86,6 +93,9 @@ namespace Engine {
     void Scene::OnPhysics2DStop() {
         b2World* world = static_cast<b2World*>(m_PhysicsWorld);
         
+        if (Physics2D::GetWorld() == m_PhysicsWorld)
+            Physics2D::SetWorld(nullptr);
+        
         // Destroy all Box2D bodies
         auto view = m_Registry.view<Rigidbody2DComponent>();
         for (auto e : view) {
@@ -112,12 +122,12 @@ namespace Engine {
     }
 
     void Scene::OnPhysics2DUpdate(TimeStep ts) {
-        // Sync kinematic bodies: Transform -> Box2D (before physics step)
+        // Sync kinematic bodies: world transform -> Box2D (before physics step)
         {
-            auto view = m_Registry.view<TransformComponent, Rigidbody2DComponent>();
+            auto view = m_Registry.view<WorldTransformComponent, Rigidbody2DComponent>();
             for (auto e : view) {
                 Entity entity = { e, this };
-                auto& transform = entity.GetComponent<TransformComponent>();
+                auto& transform = entity.GetComponent<WorldTransformComponent>();
                 auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
                 
                 b2Body* body = static_cast<b2Body*>(rb2d.RuntimeBody);
@@ -148,12 +158,25 @@ namespace Engine {
             
             b2Body* body = static_cast<b2Body*>(rb2d.RuntimeBody);
             
-            // For dynamic bodies, sync transform FROM Box2D
+            // For dynamic bodies, sync transform FROM Box2D. The body is in world
+            // space, a parented entity stores it relative to its parent.
             if (rb2d.Type == Rigidbody2DComponent::BodyType::Dynamic) {
                 const auto& position = body->GetPosition();
-                transform.Position.x = position.x;
-                transform.Position.y = position.y;
-                transform.Rotation.z = body->GetAngle();
+                auto* relationship = m_Registry.try_get<RelationshipComponent>(e);
+                auto* parent = relationship && relationship->Parent != entt::null
+                    ? m_Registry.try_get<WorldTransformComponent>(relationship->Parent) : nullptr;
+                
+                if (parent) {
+                    glm::vec4 local = glm::inverse(parent->Transform)
+                        * glm::vec4(position.x, position.y, m_Registry.get<WorldTransformComponent>(e).Position.z, 1.0f);
+                    transform.Position.x = local.x;
+                    transform.Position.y = local.y;
+                    transform.Rotation.z = body->GetAngle() - parent->Rotation.z;
+                } else {
+                    transform.Position.x = position.x;
+                    transform.Position.y = position.y;
+                    transform.Rotation.z = body->GetAngle();
+                }
             }
             
             // Update velocity in component (for all body types)
@@ -1,15 +1,62 @@
 #include "Engine/Scene/Scene.h"
 #include "Engine/Scene/Entity.h"
 #include "Engine/Scene/Components.h"
+#include "Engine/Scene/SystemScheduler.h"
 #include "Engine/Renderer/Renderer2D.h"
+#include "Engine/Audio/AudioEngine.h"
 #include "Engine/Physics/ContactListener.h"
+#include "Engine/Physics/Physics2D.h"
 #include "Engine/Scripting/ScriptEngine.h"
 #include "Engine/Core/Logger.h"
+#include "Engine/Debug/Profiler.h"
 #include <box2d/box2d.h>
 #include <glm/gtc/constants.hpp>
+#include <algorithm>
 
 namespace Engine {
 
+    static bool IsSameTransform(const TransformComponent& a, const TransformComponent& b) {
+        return a.Position == b.Position && a.Rotation == b.Rotation && a.Scale == b.Scale;
+    }
+
+    static const WorldTransformComponent* GetParentWorldTransform(const entt::registry& registry, entt::entity entity) {
+        const auto* relationship = registry.try_get<RelationshipComponent>(entity);
+        if (!relationship || relationship->Parent == entt::null)
+            return nullptr;
+        return registry.try_get<WorldTransformComponent>(relationship->Parent);
+    }
+
+    static void ComposeWorldTransform(const TransformComponent& local, const WorldTransformComponent* parent,
+                                      WorldTransformComponent& world) {
+        world.Local = local;
+        world.Dirty = false;
+        
+        if (!parent) {
+            world.Transform = local.GetTransform();
+            world.Position = local.Position;
+            world.Rotation = local.Rotation;
+            world.Scale = local.Scale;
+            return;
+        }
+        
+        world.Transform = parent->Transform * local.GetTransform();
+        world.Position = glm::vec3(world.Transform[3]);
+        
+        // Read back from the matrix, so a rotated parent scales its children along its
+        // own axes. A mirrored transform keeps the flip on x. Under non-uniform parent
+        // scale a rotated child is sheared, which Rotation and Scale only approximate.
+        // Only z rotation is decomposed; x and y are summed, the 2D systems ignore them.
+        const glm::vec3 axisX = glm::vec3(world.Transform[0]);
+        const glm::vec3 axisY = glm::vec3(world.Transform[1]);
+        const float flip = axisX.x * axisY.y - axisX.y * axisY.x < 0.0f ? -1.0f : 1.0f;
+        world.Scale = { glm::length(axisX) * flip, glm::length(axisY), glm::length(glm::vec3(world.Transform[2])) };
+        world.Rotation = {
+            parent->Rotation.x + local.Rotation.x,
+            parent->Rotation.y + local.Rotation.y,
+            std::atan2(axisX.y * flip, axisX.x * flip)
+        };
+    }
+
     Scene::Scene(const std::string& name)
         : m_Name(name) {
         // Create physics world
@@ -21,10 +68,28 @@ namespace Engine {
         
         // Create particle system
         m_ParticleSystem = CreateScope<ParticleSystem>(10000);
+        
+        m_Systems = CreateScope<SystemScheduler>(m_Registry);
+        RegisterSystems();
+        
+        // Every transform gets a cached world transform
+        m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformConstructed>(this);
+        m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroyed>(this);
+        
+        // Any change touching a static sprite invalidates the baked batch. Moves are
+        // caught by UpdateWorldTransforms.
+        m_Registry.on_construct<StaticSpriteComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
+        m_Registry.on_update<StaticSpriteComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
+        m_Registry.on_destroy<StaticSpriteComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
+        m_Registry.on_construct<SpriteRendererComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
+        m_Registry.on_update<SpriteRendererComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
+        m_Registry.on_destroy<SpriteRendererComponent>().connect<&Scene::OnStaticSpriteChanged>(this);
     }
 
     Scene::~Scene() {
         // Clean up physics world
+        if (m_PhysicsWorld && Physics2D::GetWorld() == m_PhysicsWorld)
+            Physics2D::SetWorld(nullptr);
         if (m_PhysicsWorld) {
             delete static_cast<b2World*>(m_PhysicsWorld);
             m_PhysicsWorld = nullptr;
@@ -55,9 +120,164 @@ namespace Engine {
             }
         }
         
+        if (m_Registry.all_of<RelationshipComponent>(entity)) {
+            // Each child unlinks itself, so the list shrinks from the front
+            entt::entity child;
+            while ((child = m_Registry.get<RelationshipComponent>(entity).FirstChild) != entt::null)
+                DestroyEntity({ child, this });
+            
+            UnlinkFromParent(entity);
+        }
+        
         m_Registry.destroy(entity);
     }
 
+    void Scene::SetParent(Entity child, Entity parent) {
+        for (entt::entity ancestor = parent; ancestor != entt::null; ) {
+            if (ancestor == (entt::entity)child) {
+                GE_CORE_WARN("Cannot parent an entity to itself or one of its children");
+                return;
+            }
+            
+            auto* relationship = m_Registry.try_get<RelationshipComponent>(ancestor);
+            ancestor = relationship ? relationship->Parent : entt::null;
+        }
+        
+        // Emplace both before holding references, emplacing may move the storage
+        m_Registry.get_or_emplace<RelationshipComponent>(child);
+        if (parent)
+            m_Registry.get_or_emplace<RelationshipComponent>(parent);
+        
+        UnlinkFromParent(child);
+        
+        uint32_t depth = 0;
+        if (parent) {
+            auto& relationship = m_Registry.get<RelationshipComponent>(child);
+            auto& parentRelationship = m_Registry.get<RelationshipComponent>(parent);
+            relationship.Parent = parent;
+            
+            // Append, so children stay in the order they were attached
+            if (parentRelationship.FirstChild == entt::null) {
+                parentRelationship.FirstChild = child;
+            } else {
+                entt::entity last = parentRelationship.FirstChild;
+                while (m_Registry.get<RelationshipComponent>(last).NextSibling != entt::null)
+                    last = m_Registry.get<RelationshipComponent>(last).NextSibling;
+                m_Registry.get<RelationshipComponent>(last).NextSibling = child;
+            }
+            
+            depth = parentRelationship.Depth + 1;
+        }
+        
+        UpdateHierarchyDepth(child, depth);
+        
+        if (auto* world = m_Registry.try_get<WorldTransformComponent>(child))
+            world->Dirty = true;
+        m_TransformOrderDirty = true;
+    }
+
+    Entity Scene::GetParent(Entity entity) {
+        auto* relationship = m_Registry.try_get<RelationshipComponent>(entity);
+        if (!relationship || relationship->Parent == entt::null)
+            return {};
+        return { relationship->Parent, this };
+    }
+
+    void Scene::UnlinkFromParent(entt::entity entity) {
+        auto& relationship = m_Registry.get<RelationshipComponent>(entity);
+        if (relationship.Parent == entt::null)
+            return;
+        
+        auto& parent = m_Registry.get<RelationshipComponent>(relationship.Parent);
+        if (parent.FirstChild == entity) {
+            parent.FirstChild = relationship.NextSibling;
+        } else {
+            entt::entity sibling = parent.FirstChild;
+            while (m_Registry.get<RelationshipComponent>(sibling).NextSibling != entity)
+                sibling = m_Registry.get<RelationshipComponent>(sibling).NextSibling;
+            m_Registry.get<RelationshipComponent>(sibling).NextSibling = relationship.NextSibling;
+        }
+        
+        relationship.Parent = entt::null;
+        relationship.NextSibling = entt::null;
+    }
+
+    void Scene::UpdateHierarchyDepth(entt::entity entity, uint32_t depth) {
+        auto& relationship = m_Registry.get<RelationshipComponent>(entity);
+        relationship.Depth = depth;
+        
+        for (entt::entity child = relationship.FirstChild; child != entt::null;
+             child = m_Registry.get<RelationshipComponent>(child).NextSibling)
+            UpdateHierarchyDepth(child, depth + 1);
+    }
+
+    void Scene::OnTransformConstructed(entt::registry& registry, entt::entity entity) {
+        registry.emplace<WorldTransformComponent>(entity);
+        m_TransformOrderDirty = true;
+    }
+
+    void Scene::OnTransformDestroyed(entt::registry& registry, entt::entity entity) {
+        registry.remove<WorldTransformComponent>(entity);
+        m_TransformOrderDirty = true;
+    }
+
+    void Scene::UpdateWorldTransforms() {
+        if (m_TransformOrderDirty) {
+            auto view = m_Registry.view<TransformComponent, WorldTransformComponent>();
+            m_TransformOrder.assign(view.begin(), view.end());
+            
+            auto depthOf = [this](entt::entity entity) {
+                auto* relationship = m_Registry.try_get<RelationshipComponent>(entity);
+                return relationship ? relationship->Depth : 0u;
+            };
+            std::stable_sort(m_TransformOrder.begin(), m_TransformOrder.end(), [&](entt::entity a, entt::entity b) {
+                return depthOf(a) < depthOf(b);
+            });
+            m_TransformOrderDirty = false;
+        }
+        
+        // Parents come first, so a parent's Changed flag is final by the time its
+        // children are visited
+        for (entt::entity entity : m_TransformOrder) {
+            auto& local = m_Registry.get<TransformComponent>(entity);
+            auto& world = m_Registry.get<WorldTransformComponent>(entity);
+            const WorldTransformComponent* parent = GetParentWorldTransform(m_Registry, entity);
+            
+            world.Changed = world.Dirty || (parent && parent->Changed) || !IsSameTransform(world.Local, local);
+            if (!world.Changed)
+                continue;
+            
+            ComposeWorldTransform(local, parent, world);
+            
+            if (m_Registry.all_of<StaticSpriteComponent>(entity))
+                m_StaticBatchDirty = true;
+        }
+    }
+
+    WorldTransformComponent Scene::ComputeWorldTransform(entt::entity entity) {
+        WorldTransformComponent world;
+        ComposeWorldTransform(m_Registry.get<TransformComponent>(entity), GetParentWorldTransform(m_Registry, entity), world);
+        return world;
+    }
+
+    void Scene::SyncAudio() {
+        auto sources = m_Registry.view<WorldTransformComponent, AudioSourceComponent>();
+        for (auto entity : sources) {
+            auto [world, audio] = sources.get<WorldTransformComponent, AudioSourceComponent>(entity);
+            if (audio.Is3D && audio.Source)
+                audio.Source->SetPosition(world.Position);
+        }
+        
+        auto listeners = m_Registry.view<WorldTransformComponent, AudioListenerComponent>();
+        for (auto entity : listeners) {
+            auto [world, listener] = listeners.get<WorldTransformComponent, AudioListenerComponent>(entity);
+            if (listener.Active) {
+                AudioEngine::SetListenerPosition(world.Position.x, world.Position.y, world.Position.z);
+                break;
+            }
+        }
+    }
+
     void Scene::OnStart() {
         OnPhysics2DStart();
         
@@ -100,208 +320,325 @@ namespace Engine {
         GE_CORE_INFO("Scene '{0}' started", m_Name);
     }
 
+    void Scene::RegisterSystems() {
+        // Same order as the old hand-written update. A system only starts after the
+        // latest earlier system it conflicts with, so just animation and particles,
+        // which were already adjacent and share no data, end up running in parallel.
+        m_Systems->AddSystem("Animation", [this](TimeStep ts) { UpdateAnimations(ts); })
+            .Writes<AnimationComponent, SpriteRendererComponent>();
+        m_Systems->AddSystem("Particles", [this](TimeStep ts) { UpdateParticles(ts); })
+            .Reads<WorldTransformComponent>()
+            .Writes<ParticleEmitterComponent>()
+            .WritesResource<ParticleSystem>();
+        
+        // Lua may touch anything, so scripts run alone
+        m_Systems->AddSystem("Scripts", [this](TimeStep ts) { UpdateScripts(ts); })
+            .Exclusive();
+        
+        // Kinematic bodies follow their world transform
+        m_Systems->AddSystem("World Transforms", [this](TimeStep) { UpdateWorldTransforms(); })
+            .Reads<TransformComponent, RelationshipComponent, StaticSpriteComponent>()
+            .Writes<WorldTransformComponent>();
+        m_Systems->AddSystem("Physics 2D", [this](TimeStep ts) { OnPhysics2DUpdate(ts); })
+            .Reads<WorldTransformComponent, RelationshipComponent>()
+            .Writes<TransformComponent, Rigidbody2DComponent>()
+            .WritesResource<b2World>();
+        m_Systems->AddSystem("World Bounds", [this](TimeStep) { ClampToWorldBounds(); })
+            .Writes<TransformComponent, RigidbodyComponent, Rigidbody2DComponent>()
+            .WritesResource<b2World>();
+        m_Systems->AddSystem("Legacy Physics", [this](TimeStep ts) { UpdateLegacyPhysics(ts); })
+            .Writes<TransformComponent, RigidbodyComponent>();
+        
+        m_Systems->AddSystem("World Transforms (Post Physics)", [this](TimeStep) { UpdateWorldTransforms(); })
+            .Reads<TransformComponent, RelationshipComponent, StaticSpriteComponent>()
+            .Writes<WorldTransformComponent>();
+        m_Systems->AddSystem("Audio", [this](TimeStep) { SyncAudio(); })
+            .Reads<WorldTransformComponent, AudioSourceComponent, AudioListenerComponent>();
+    }
+
     void Scene::OnUpdate(TimeStep ts) {
-        // Update animations
-        {
-            auto view = m_Registry.view<AnimationComponent>();
-            for (auto entity : view) {
-                auto& anim = view.get<AnimationComponent>(entity);
-                anim.Animator.Update(ts);
-                
-                // Update sprite renderer with current animation frame
-                auto* sprite = m_Registry.try_get<SpriteRendererComponent>((entt::entity)entity);
-                if (sprite) {
-                    auto texture = anim.Animator.GetCurrentTexture();
-                    if (texture) {
-                        sprite->SubTexture = texture;
-                    }
+        GE_PROFILE_SCOPE("Scene::OnUpdate");
+        m_Systems->Run(ts);
+    }
+
+    void Scene::UpdateScripts(TimeStep ts) {
+        auto view = m_Registry.view<ScriptComponent>();
+        for (auto entity : view) {
+            auto& script = view.get<ScriptComponent>(entity);
+            
+            if (script.OnUpdate) {
+                auto result = script.OnUpdate(script.Instance, (float)ts);
+                if (!result.valid()) {
+                    sol::error err = result;
+                    GE_CORE_ERROR("Error in OnUpdate: {}", err.what());
                 }
             }
         }
-        
+    }
+
+    void Scene::UpdateAnimations(TimeStep ts) {
+        auto view = m_Registry.view<AnimationComponent>();
+        for (auto entity : view) {
+            auto& anim = view.get<AnimationComponent>(entity);
+            anim.Animator.Update(ts);
+            
+            // Update sprite renderer with current animation frame
+            auto* sprite = m_Registry.try_get<SpriteRendererComponent>((entt::entity)entity);
+            if (sprite) {
+                auto texture = anim.Animator.GetCurrentTexture();
+                if (texture && texture != sprite->SubTexture) {
+                    // Patched so a static sprite's batch picks up the new frame
+                    m_Registry.patch<SpriteRendererComponent>((entt::entity)entity, [&](SpriteRendererComponent& renderer) {
+                        renderer.SubTexture = texture;
+                    });
+                }
+            }
+        }
+    }
+
+    void Scene::UpdateParticles(TimeStep ts) {
         // Update particle emitters
-        {
-            auto view = m_Registry.view<TransformComponent, ParticleEmitterComponent>();
-            for (auto entity : view) {
-                auto& transform = view.get<TransformComponent>(entity);
-                auto& emitter = view.get<ParticleEmitterComponent>(entity);
-                
-                if (!emitter.Emit)
-                    continue;
-                
-                emitter.Properties.Position = { transform.Position.x, transform.Position.y };
+        auto view = m_Registry.view<WorldTransformComponent, ParticleEmitterComponent>();
+        for (auto entity : view) {
+            auto& transform = view.get<WorldTransformComponent>(entity);
+            auto& emitter = view.get<ParticleEmitterComponent>(entity);
+            
+            if (!emitter.Emit)
+                continue;
+            
+            emitter.Properties.Position = { transform.Position.x, transform.Position.y };
+            
+            if (emitter.BurstMode) {
+                m_ParticleSystem->EmitBurst(emitter.Properties, emitter.BurstCount);
+                emitter.Emit = false; // One-time burst
+            } else {
+                // Continuous emission
+                emitter.EmissionTimer += (float)ts;
+                float interval = 1.0f / emitter.EmissionRate;
                 
-                if (emitter.BurstMode) {
-                    m_ParticleSystem->EmitBurst(emitter.Properties, emitter.BurstCount);
-                    emitter.Emit = false; // One-time burst
-                } else {
-                    // Continuous emission
-                    emitter.EmissionTimer += (float)ts;
-                    float interval = 1.0f / emitter.EmissionRate;
-                    
-                    while (emitter.EmissionTimer >= interval) {
-                        m_ParticleSystem->Emit(emitter.Properties);
-                        emitter.EmissionTimer -= interval;
-                    }
+                while (emitter.EmissionTimer >= interval) {
+                    m_ParticleSystem->Emit(emitter.Properties);
+                    emitter.EmissionTimer -= interval;
                 }
             }
         }
         
         // Update particle system
         m_ParticleSystem->OnUpdate(ts);
+    }
+
+    void Scene::ClampToWorldBounds() {
+        if (!m_UseWorldBounds)
+            return;
         
-        // Update scripts
-        {
-            auto view = m_Registry.view<ScriptComponent>();
-            for (auto entity : view) {
-                auto& script = view.get<ScriptComponent>(entity);
+        auto view = m_Registry.view<TransformComponent>();
+        for (auto entity : view) {
+            Entity e = { entity, this };
+            if (!IsEntityInBounds(e)) {
+                auto& transform = e.GetComponent<TransformComponent>();
                 
-                if (script.OnUpdate) {
-                    auto result = script.OnUpdate(script.Instance, (float)ts);
-                    if (!result.valid()) {
-                        sol::error err = result;
-                        GE_CORE_ERROR("Error in OnUpdate: {}", err.what());
-                    }
+                // Clamp position within bounds
+                transform.Position.x = glm::clamp(transform.Position.x, m_WorldBoundsMin.x, m_WorldBoundsMax.x);
+                transform.Position.y = glm::clamp(transform.Position.y, m_WorldBoundsMin.y, m_WorldBoundsMax.y);
+                
+                // Reset velocity if entity has rigidbody
+                if (e.HasComponent<RigidbodyComponent>()) {
+                    auto& rb = e.GetComponent<RigidbodyComponent>();
+                    rb.Velocity = { 0.0f, 0.0f };
                 }
-            }
-        }
-        
-        // Update Box2D physics
-        OnPhysics2DUpdate(ts);
-        
-        // Check world bounds for entities
-        if (m_UseWorldBounds) {
-            auto view = m_Registry.view<TransformComponent>();
-            for (auto entity : view) {
-                Entity e = { entity, this };
-                if (!IsEntityInBounds(e)) {
-                    auto& transform = e.GetComponent<TransformComponent>();
-                    
-                    // Clamp position within bounds
-                    transform.Position.x = glm::clamp(transform.Position.x, m_WorldBoundsMin.x, m_WorldBoundsMax.x);
-                    transform.Position.y = glm::clamp(transform.Position.y, m_WorldBoundsMin.y, m_WorldBoundsMax.y);
-                    
-                    // Reset velocity if entity has rigidbody
-                    if (e.HasComponent<RigidbodyComponent>()) {
-                        auto& rb = e.GetComponent<RigidbodyComponent>();
-                        rb.Velocity = { 0.0f, 0.0f };
-                    }
-                    
-                    // Reset Box2D velocity if entity has rigidbody2d
-                    if (e.HasComponent<Rigidbody2DComponent>()) {
-                        auto& rb2d = e.GetComponent<Rigidbody2DComponent>();
-                        if (rb2d.RuntimeBody) {
-                            b2Body* body = static_cast<b2Body*>(rb2d.RuntimeBody);
-                            body->SetLinearVelocity(b2Vec2(0.0f, 0.0f));
-                            body->SetTransform(b2Vec2(transform.Position.x, transform.Position.y), transform.Rotation.z);
-                        }
+                
+                // Reset Box2D velocity if entity has rigidbody2d
+                if (e.HasComponent<Rigidbody2DComponent>()) {
+                    auto& rb2d = e.GetComponent<Rigidbody2DComponent>();
+                    if (rb2d.RuntimeBody) {
+                        b2Body* body = static_cast<b2Body*>(rb2d.RuntimeBody);
+                        body->SetLinearVelocity(b2Vec2(0.0f, 0.0f));
+                        body->SetTransform(b2Vec2(transform.Position.x, transform.Position.y), transform.Rotation.z);
                     }
                 }
             }
         }
-        
-        // Update simple physics (legacy, for entities without Box2D)
-        {
-            auto view = m_Registry.view<TransformComponent, RigidbodyComponent>();
-            for (auto entity : view) {
-                auto& transform = view.get<TransformComponent>(entity);
-                auto& rb = view.get<RigidbodyComponent>(entity);
-                
-                // Apply gravity
-                if (rb.UseGravity) {
-                    rb.Acceleration.y = -9.81f;
-                }
-                
-                // Update velocity
-                rb.Velocity += rb.Acceleration * (float)ts;
-                
-                // Apply drag
-                rb.Velocity *= (1.0f - rb.Drag * (float)ts);
-                
-                // Update position
-                transform.Position.x += rb.Velocity.x * (float)ts;
-                transform.Position.y += rb.Velocity.y * (float)ts;
-                
-                // Reset acceleration
-                rb.Acceleration = { 0.0f, 0.0f };
+    }
+
+    // Simple physics for entities without Box2D
+    void Scene::UpdateLegacyPhysics(TimeStep ts) {
+        auto view = m_Registry.view<TransformComponent, RigidbodyComponent>();
+        for (auto entity : view) {
+            auto& transform = view.get<TransformComponent>(entity);
+            auto& rb = view.get<RigidbodyComponent>(entity);
+            
+            // Apply gravity
+            if (rb.UseGravity) {
+                rb.Acceleration.y = -9.81f;
             }
+            
+            // Update velocity
+            rb.Velocity += rb.Acceleration * (float)ts;
+            
+            // Apply drag
+            rb.Velocity *= (1.0f - rb.Drag * (float)ts);
+            
+            // Update position
+            transform.Position.x += rb.Velocity.x * (float)ts;
+            transform.Position.y += rb.Velocity.y * (float)ts;
+            
+            // Reset acceleration
+            rb.Acceleration = { 0.0f, 0.0f };
         }
     }
 
     void Scene::OnRender() {
+        // Picks up edits made outside OnUpdate, e.g. from the editor
+        UpdateWorldTransforms();
+        
         // Find primary camera
         OrthographicCamera* mainCamera = nullptr;
         glm::mat4 cameraTransform;
         {
-            auto view = m_Registry.view<TransformComponent, CameraComponent>();
+            auto view = m_Registry.view<WorldTransformComponent, CameraComponent>();
             for (auto entity : view) {
                 auto& camera = view.get<CameraComponent>(entity);
                 if (camera.Primary) {
                     mainCamera = &camera.Camera;
-                    cameraTransform = view.get<TransformComponent>(entity).GetTransform();
+                    cameraTransform = view.get<WorldTransformComponent>(entity).Transform;
                     break;
                 }
             }
         }
         
         if (mainCamera) {
+            GE_PROFILE_GPU_SCOPE("Scene::OnRender");
             Renderer2D::BeginScene(*mainCamera);
             
-            // Render sprites
-            auto group = m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-            size_t count = 0;
-            for (auto entity : group) {
-                count++;
-                Entity e = { entity, this };
-                auto [transform, sprite] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-                
-                // Check for rotation (Box2D uses radians)
-                bool hasRotation = std::abs(transform.Rotation.z) > 0.001f;
-                float rotationDegrees = glm::degrees(transform.Rotation.z);
-                
-                // Check if entity has CircleCollider to render as circle
-                bool isCircle = e.HasComponent<CircleCollider2DComponent>();
-                
-                if (isCircle) {
-                    // Draw as circle
-                    auto& circleCollider = e.GetComponent<CircleCollider2DComponent>();
-                    float radius = circleCollider.Radius * std::max(transform.Scale.x, transform.Scale.y);
-                    Renderer2D::DrawCircle(transform.Position, radius, sprite.Color);
-                } else if (hasRotation) {
-                    // Draw with rotation
-                    if (sprite.SubTexture) {
-                        Renderer2D::DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
-                                                   rotationDegrees, sprite.SubTexture->GetTexture(), 
-                                                   sprite.TilingFactor, sprite.Color);
-                    } else if (sprite.Texture) {
-                        Renderer2D::DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
-                                                   rotationDegrees, sprite.Texture, 
-                                                   sprite.TilingFactor, sprite.Color);
-                    } else {
-                        Renderer2D::DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
-                                                   rotationDegrees, sprite.Color);
+            // Static sprites come from the baked batch and are never iterated here
+            if (m_StaticBatchDirty)
+                RebuildStaticBatch();
+            Renderer2D::DrawStaticBatch(m_StaticBatch);
+            
+            // Tilemaps draw their visible chunks from cached geometry
+            {
+                auto view = m_Registry.view<WorldTransformComponent, TilemapComponent>();
+                for (auto entity : view) {
+                    auto [transform, tilemap] = view.get<WorldTransformComponent, TilemapComponent>(entity);
+                    tilemap.Tilemap.OnRender(transform.Transform);
+                }
+            }
+            
+            // Render sprites, recorded in parallel slices and merged in entity order.
+            // Workers only read components; views are created up front so no storage
+            // is added to the registry while they run.
+            auto group = m_Registry.group<WorldTransformComponent>(entt::get<SpriteRendererComponent>, entt::exclude<StaticSpriteComponent>);
+            auto circles = m_Registry.view<CircleCollider2DComponent>();
+            m_RenderEntities.assign(group.begin(), group.end());
+            
+            Renderer2D::RecordParallel((uint32_t)m_RenderEntities.size(), [&](uint32_t begin, uint32_t end, QuadRecorder& recorder) {
+                for (uint32_t i = begin; i < end; i++) {
+                    entt::entity entity = m_RenderEntities[i];
+                    auto [transform, sprite] = group.get<WorldTransformComponent, SpriteRendererComponent>(entity);
+                    
+                    // Check for rotation (Box2D uses radians)
+                    bool hasRotation = std::abs(transform.Rotation.z) > 0.001f;
+                    float rotationDegrees = glm::degrees(transform.Rotation.z);
+                    
+                    // Check if entity has CircleCollider to render as circle
+                    bool isCircle = circles.contains(entity);
+                    float radius = 0.0f;
+                    
+                    // Reject off-screen sprites before anything is recorded
+                    glm::vec2 halfExtent = glm::abs(glm::vec2(transform.Scale)) * 0.5f;
+                    if (isCircle) {
+                        radius = circles.get<CircleCollider2DComponent>(entity).Radius * std::max(transform.Scale.x, transform.Scale.y);
+                        halfExtent = glm::vec2(radius);
+                    } else if (hasRotation) {
+                        halfExtent = glm::vec2(glm::length(halfExtent));
                     }
-                } else {
-                    // Draw without rotation
-                    if (sprite.SubTexture) {
-                        Renderer2D::DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
-                                            sprite.SubTexture->GetTexture(), sprite.TilingFactor, sprite.Color);
-                    } else if (sprite.Texture) {
-                        Renderer2D::DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
-                                            sprite.Texture, sprite.TilingFactor, sprite.Color);
+                    
+                    if (!recorder.IsVisible(glm::vec2(transform.Position), halfExtent))
+                        continue;
+                    
+                    if (isCircle) {
+                        // Draw as circle
+                        recorder.DrawCircle(transform.Position, radius, sprite.Color);
+                    } else if (hasRotation) {
+                        // Draw with rotation
+                        if (sprite.SubTexture) {
+                            recorder.DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
+                                                     rotationDegrees, sprite.SubTexture, 
+                                                     sprite.TilingFactor, sprite.Color);
+                        } else if (sprite.Texture) {
+                            recorder.DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
+                                                     rotationDegrees, sprite.Texture, 
+                                                     sprite.TilingFactor, sprite.Color);
+                        } else {
+                            recorder.DrawRotatedQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
+                                                     rotationDegrees, sprite.Color);
+                        }
                     } else {
-                        Renderer2D::DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, sprite.Color);
+                        // Draw without rotation
+                        if (sprite.SubTexture) {
+                            recorder.DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
+                                              sprite.SubTexture, sprite.TilingFactor, sprite.Color);
+                        } else if (sprite.Texture) {
+                            recorder.DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, 
+                                              sprite.Texture, sprite.TilingFactor, sprite.Color);
+                        } else {
+                            recorder.DrawQuad(transform.Position, {transform.Scale.x, transform.Scale.y}, sprite.Color);
+                        }
                     }
                 }
-            }
+            });
             
             // Render particles
             m_ParticleSystem->OnRender();
             
             Renderer2D::EndScene();
+            
+            // Collider outlines, AABBs and raycasts when physics debug draw is on. A scene
+            // of their own keeps them on top of sorted sprites too.
+            if (m_PhysicsWorld && Physics2D::GetWorld() == m_PhysicsWorld) {
+                if (Physics2D::IsDebugDrawEnabled()) {
+                    Renderer2D::BeginScene(*mainCamera);
+                    Physics2D::DrawDebug();
+                    Renderer2D::EndScene();
+                } else {
+                    Physics2D::DrawDebug(); // Only drops the frame's raycast traces
+                }
+            }
         }
     }
 
+    void Scene::OnStaticSpriteChanged(entt::registry& registry, entt::entity entity) {
+        if (registry.all_of<StaticSpriteComponent>(entity))
+            m_StaticBatchDirty = true;
+    }
+
+    void Scene::RebuildStaticBatch() {
+        std::vector<Renderer2D::StaticQuad> quads;
+        
+        auto view = m_Registry.view<WorldTransformComponent, SpriteRendererComponent, StaticSpriteComponent>();
+        for (auto entity : view) {
+            if (!view.get<StaticSpriteComponent>(entity).Visible)
+                continue;
+            
+            auto& transform = view.get<WorldTransformComponent>(entity);
+            auto& sprite = view.get<SpriteRendererComponent>(entity);
+            
+            Renderer2D::StaticQuad quad;
+            quad.Position = transform.Position;
+            quad.Size = { transform.Scale.x, transform.Scale.y };
+            quad.Rotation = glm::degrees(transform.Rotation.z);
+            quad.Color = sprite.Color;
+            quad.Texture = sprite.Texture;
+            quad.SubTexture = sprite.SubTexture;
+            quad.TilingFactor = sprite.TilingFactor;
+            quads.push_back(quad);
+        }
+        
+        m_StaticBatch = Renderer2D::BuildStaticBatch(quads);
+        m_StaticBatchDirty = false;
+        GE_CORE_TRACE("Rebuilt static sprite batch ({0} sprites)", quads.size());
+    }
+
     void Scene::OnStop() {
         OnPhysics2DStop();
         GE_CORE_INFO("Scene '{0}' stopped", m_Name);
@@ -372,7 +709,8 @@ namespace Engine {
             return;
         }
             
-        auto& transform = entity.GetComponent<TransformComponent>();
+        // Bodies live in world space; the cache may not have seen this entity yet
+        WorldTransformComponent transform = ComputeWorldTransform(entity);
         auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
         
         // If body already exists, don't create again
@@ -478,8 +816,11 @@ namespace Engine {
     // Explicit template instantiations for all component types
     template void Scene::OnComponentAdded<TagComponent>(Entity, TagComponent&);
     template void Scene::OnComponentAdded<TransformComponent>(Entity, TransformComponent&);
+    template void Scene::OnComponentAdded<RelationshipComponent>(Entity, RelationshipComponent&);
     template void Scene::OnComponentAdded<CameraComponent>(Entity, CameraComponent&);
     template void Scene::OnComponentAdded<SpriteRendererComponent>(Entity, SpriteRendererComponent&);
+    template void Scene::OnComponentAdded<StaticSpriteComponent>(Entity, StaticSpriteComponent&);
+    template void Scene::OnComponentAdded<TilemapComponent>(Entity, TilemapComponent&);
     template void Scene::OnComponentAdded<ScriptComponent>(Entity, ScriptComponent&);
     template void Scene::OnComponentAdded<AnimationComponent>(Entity, AnimationComponent&);
     template void Scene::OnComponentAdded<ParticleEmitterComponent>(Entity, ParticleEmitterComponent&);
@@ -498,7 +839,7 @@ namespace Engine {
         if (entity.HasComponent<Rigidbody2DComponent>()) {
             // Body exists, need to add fixture
             auto& rb = entity.GetComponent<Rigidbody2DComponent>();
-            auto& transform = entity.GetComponent<TransformComponent>();
+            WorldTransformComponent transform = ComputeWorldTransform(entity);
             
             if (rb.RuntimeBody) {
                 b2Body* body = static_cast<b2Body*>(rb.RuntimeBody);
@@ -527,7 +868,7 @@ namespace Engine {
     void Scene::OnComponentAdded<CircleCollider2DComponent>(Entity entity, CircleCollider2DComponent& component) {
         if (entity.HasComponent<Rigidbody2DComponent>()) {
             auto& rb = entity.GetComponent<Rigidbody2DComponent>();
-            auto& transform = entity.GetComponent<TransformComponent>();
+            WorldTransformComponent transform = ComputeWorldTransform(entity);
             
             if (rb.RuntimeBody) {
                 b2Body* body = static_cast<b2Body*>(rb.RuntimeBody);
@@ -5,6 +5,7 @@
 
 #include <yaml-cpp/yaml.h>
 #include <fstream>
+#include <unordered_map>
 
 namespace Engine {
 
@@ -53,6 +54,17 @@ namespace Engine {
                 out << YAML::EndMap;
             }
             
+            // Children are rebuilt from the parent links on load
+            if (entity.HasComponent<RelationshipComponent>()) {
+                auto& relationship = entity.GetComponent<RelationshipComponent>();
+                if (relationship.Parent != entt::null) {
+                    out << YAML::Key << "RelationshipComponent";
+                    out << YAML::BeginMap;
+                    out << YAML::Key << "Parent" << YAML::Value << (uint32_t)relationship.Parent;
+                    out << YAML::EndMap;
+                }
+            }
+            
             if (entity.HasComponent<SpriteRendererComponent>()) {
                 auto& src = entity.GetComponent<SpriteRendererComponent>();
                 out << YAML::Key << "SpriteRendererComponent";
@@ -66,6 +78,41 @@ namespace Engine {
                 out << YAML::EndMap;
             }
             
+            if (entity.HasComponent<StaticSpriteComponent>()) {
+                auto& staticSprite = entity.GetComponent<StaticSpriteComponent>();
+                out << YAML::Key << "StaticSpriteComponent";
+                out << YAML::BeginMap;
+                out << YAML::Key << "Visible" << YAML::Value << staticSprite.Visible;
+                out << YAML::EndMap;
+            }
+            
+            if (entity.HasComponent<TilemapComponent>()) {
+                auto& tilemap = entity.GetComponent<TilemapComponent>();
+                const Tilemap& map = tilemap.Tilemap;
+                out << YAML::Key << "TilemapComponent";
+                out << YAML::BeginMap;
+                out << YAML::Key << "Width" << YAML::Value << map.GetWidth();
+                out << YAML::Key << "Height" << YAML::Value << map.GetHeight();
+                out << YAML::Key << "TileSize" << YAML::Value << map.GetTileSize();
+                out << YAML::Key << "TilesetPath" << YAML::Value << tilemap.TilesetPath;
+                out << YAML::Key << "CellSize";
+                out << YAML::Flow << YAML::BeginSeq << map.GetCellSize().x << map.GetCellSize().y << YAML::EndSeq;
+                
+                // Run-length packed as [tile, count, tile, count, ...], row-major from the bottom row
+                out << YAML::Key << "Tiles";
+                out << YAML::Flow << YAML::BeginSeq;
+                const std::vector<int32_t>& tiles = map.GetTiles();
+                for (size_t i = 0; i < tiles.size();) {
+                    size_t run = 1;
+                    while (i + run < tiles.size() && tiles[i + run] == tiles[i])
+                        run++;
+                    out << tiles[i] << run;
+                    i += run;
+                }
+                out << YAML::EndSeq;
+                out << YAML::EndMap;
+            }
+            
             if (entity.HasComponent<CameraComponent>()) {
                 auto& camera = entity.GetComponent<CameraComponent>();
                 out << YAML::Key << "CameraComponent";
@@ -220,6 +267,11 @@ namespace Engine {
         }
         
         int entityCount = 0;
+        
+        // Parents may be listed after their children, so links are made at the end
+        std::unordered_map<uint32_t, Entity> loadedEntities;
+        std::vector<std::pair<Entity, uint32_t>> parentLinks;
+        
         for (auto entity : entities) {
             try {
                 if (!entity["Entity"]) {
@@ -227,7 +279,7 @@ namespace Engine {
                     continue;
                 }
                 
-                // uint32_t uuid = entity["Entity"].as<uint32_t>(); // Reserved for future use
+                uint32_t entityID = entity["Entity"].as<uint32_t>();
                 
                 std::string name = "Entity";
                 auto tagComponent = entity["TagComponent"];
@@ -235,6 +287,7 @@ namespace Engine {
                     name = tagComponent["Tag"].as<std::string>();
                 
                 Entity deserializedEntity = m_Scene->CreateEntity(name);
+                loadedEntities[entityID] = deserializedEntity;
                 entityCount++;
                 
                 auto transformComponent = entity["TransformComponent"];
@@ -250,6 +303,10 @@ namespace Engine {
                     tc.Scale = { scale[0].as<float>(), scale[1].as<float>(), scale[2].as<float>() };
                 }
                 
+                auto relationshipComponent = entity["RelationshipComponent"];
+                if (relationshipComponent && relationshipComponent["Parent"])
+                    parentLinks.push_back({ deserializedEntity, relationshipComponent["Parent"].as<uint32_t>() });
+                
                 auto spriteRendererComponent = entity["SpriteRendererComponent"];
                 if (spriteRendererComponent) {
                     auto& src = deserializedEntity.AddComponent<SpriteRendererComponent>();
@@ -258,6 +315,37 @@ namespace Engine {
                     src.TilingFactor = spriteRendererComponent["TilingFactor"].as<float>();
                 }
                 
+                auto staticSpriteComponent = entity["StaticSpriteComponent"];
+                if (staticSpriteComponent) {
+                    auto& staticSprite = deserializedEntity.AddComponent<StaticSpriteComponent>();
+                    staticSprite.Visible = staticSpriteComponent["Visible"].as<bool>();
+                }
+                
+                auto tilemapComponent = entity["TilemapComponent"];
+                if (tilemapComponent) {
+                    auto& tilemap = deserializedEntity.AddComponent<TilemapComponent>(
+                        tilemapComponent["Width"].as<uint32_t>(), tilemapComponent["Height"].as<uint32_t>());
+                    Tilemap& map = tilemap.Tilemap;
+                    map.SetTileSize(tilemapComponent["TileSize"].as<float>());
+                    
+                    const size_t tileCount = (size_t)map.GetWidth() * map.GetHeight();
+                    std::vector<int32_t> tiles;
+                    tiles.reserve(tileCount);
+                    auto runs = tilemapComponent["Tiles"];
+                    for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+                        size_t run = std::min(runs[i + 1].as<size_t>(), tileCount - tiles.size());
+                        tiles.insert(tiles.end(), run, runs[i].as<int32_t>());
+                    }
+                    map.SetTiles(tiles);
+                    
+                    tilemap.TilesetPath = tilemapComponent["TilesetPath"].as<std::string>();
+                    if (!tilemap.TilesetPath.empty()) {
+                        auto cellSize = tilemapComponent["CellSize"];
+                        map.SetTileset(Texture2D::Create(tilemap.TilesetPath),
+                                       { cellSize[0].as<float>(), cellSize[1].as<float>() });
+                    }
+                }
+                
                 auto cameraComponent = entity["CameraComponent"];
                 if (cameraComponent) {
                     auto& camera = deserializedEntity.AddComponent<CameraComponent>();
@@ -344,6 +432,15 @@ namespace Engine {
             }
         }
         
+        for (auto& [child, parentID] : parentLinks) {
+            auto it = loadedEntities.find(parentID);
+            if (it == loadedEntities.end()) {
+                GE_CORE_WARN("Entity parent {0} not found in scene file, leaving it at the root", parentID);
+                continue;
+            }
+            m_Scene->SetParent(child, it->second);
+        }
+        
         GE_CORE_INFO("Scene deserialization complete: {0} entities loaded", entityCount);
         
         // Validate scene has at least one camera
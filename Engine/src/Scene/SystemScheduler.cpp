@@ -0,0 +1,102 @@
+#include "Engine/Scene/SystemScheduler.h"
+#include "Engine/Core/JobSystem.h"
+#include "Engine/Debug/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Engine {
+
+    SystemScheduler::SystemBuilder& SystemScheduler::SystemBuilder::Exclusive() {
+        m_Scheduler.m_Systems[m_Index].Exclusive = true;
+        m_Scheduler.m_StagesDirty = true;
+        return *this;
+    }
+
+    SystemScheduler::SystemScheduler(entt::registry& registry)
+        : m_Registry(registry) {
+    }
+
+    SystemScheduler::SystemBuilder SystemScheduler::AddSystem(const std::string& name, const SystemFunction& function) {
+        System system;
+        system.Name = name;
+        system.Function = function;
+        m_Systems.push_back(std::move(system));
+        m_StagesDirty = true;
+        return SystemBuilder(*this, (uint32_t)m_Systems.size() - 1);
+    }
+
+    void SystemScheduler::AddAccess(uint32_t index, std::type_index type, bool write) {
+        std::vector<std::type_index>& types = write ? m_Systems[index].Writes : m_Systems[index].Reads;
+        if (std::find(types.begin(), types.end(), type) == types.end())
+            types.push_back(type);
+        m_StagesDirty = true;
+    }
+
+    static bool Overlaps(const std::vector<std::type_index>& a, const std::vector<std::type_index>& b) {
+        for (const std::type_index& type : a) {
+            if (std::find(b.begin(), b.end(), type) != b.end())
+                return true;
+        }
+        return false;
+    }
+
+    bool SystemScheduler::Conflicts(const System& a, const System& b) const {
+        if (a.Exclusive || b.Exclusive)
+            return true;
+        return Overlaps(a.Writes, b.Writes) || Overlaps(a.Writes, b.Reads) || Overlaps(a.Reads, b.Writes);
+    }
+
+    void SystemScheduler::BuildStages() {
+        // Each system goes one stage after the latest conflicting system before it,
+        // so conflicting systems keep the order they were added in
+        std::vector<uint32_t> stageOf(m_Systems.size(), 0);
+        m_Stages.clear();
+
+        for (uint32_t i = 0; i < (uint32_t)m_Systems.size(); i++) {
+            uint32_t stage = 0;
+            for (uint32_t j = 0; j < i; j++) {
+                if (Conflicts(m_Systems[i], m_Systems[j]))
+                    stage = std::max(stage, stageOf[j] + 1);
+            }
+
+            stageOf[i] = stage;
+            if (stage >= m_Stages.size())
+                m_Stages.resize(stage + 1);
+            m_Stages[stage].push_back(i);
+        }
+
+        m_StagesDirty = false;
+    }
+
+    uint32_t SystemScheduler::GetStageCount() {
+        if (m_StagesDirty)
+            BuildStages();
+        return (uint32_t)m_Stages.size();
+    }
+
+    void SystemScheduler::RunSystem(System& system, TimeStep ts) {
+        auto start = std::chrono::high_resolution_clock::now();
+        system.Function(ts);
+        auto end = std::chrono::high_resolution_clock::now();
+        system.Duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0f;
+    }
+
+    void SystemScheduler::Run(TimeStep ts) {
+        if (m_StagesDirty)
+            BuildStages();
+
+        // A stage of one, and so every exclusive system, runs on the calling thread
+        for (const std::vector<uint32_t>& stage : m_Stages) {
+            JobSystem::ParallelFor((uint32_t)stage.size(), [&](uint32_t i) {
+                RunSystem(m_Systems[stage[i]], ts);
+            });
+        }
+
+#ifdef GE_ENABLE_PROFILING
+        for (const System& system : m_Systems)
+            Profiler::Get().AddResult(system.Name, system.Duration);
+#endif
+    }
+
+} // namespace Engine
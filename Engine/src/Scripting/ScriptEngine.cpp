@@ -175,6 +175,11 @@ namespace Engine {
             },
             "HasComponent_SpriteRenderer", [](Entity& e) -> bool {
                 return e.HasComponent<SpriteRendererComponent>();
+            },
+            "SetParent", &Entity::SetParent,
+            "GetParent", &Entity::GetParent,
+            "ClearParent", [](Entity& e) {
+                e.SetParent({});
             }
         );
     }
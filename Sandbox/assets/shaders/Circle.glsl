@@ -0,0 +1,52 @@
+// Circle Shader
+// One quad per circle; the edge is the signed distance from the quad centre
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_WorldPosition;
+layout(location = 1) in vec2 a_LocalPosition; // [-1, 1] across the quad
+layout(location = 2) in vec4 a_Color;
+layout(location = 3) in float a_Thickness;
+layout(location = 4) in float a_Fade;
+
+uniform mat4 u_ViewProjection;
+
+out vec2 v_LocalPosition;
+out vec4 v_Color;
+out float v_Thickness;
+out float v_Fade;
+
+void main()
+{
+    v_LocalPosition = a_LocalPosition;
+    v_Color = a_Color;
+    v_Thickness = a_Thickness;
+    v_Fade = a_Fade;
+    gl_Position = u_ViewProjection * vec4(a_WorldPosition, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_LocalPosition;
+in vec4 v_Color;
+in float v_Thickness;
+in float v_Fade;
+
+void main()
+{
+    // 0 at the rim, 1 at the centre
+    float distance = 1.0 - length(v_LocalPosition);
+    float alpha = smoothstep(0.0, v_Fade, distance);
+    alpha *= smoothstep(v_Thickness + v_Fade, v_Thickness, distance);
+
+    color = v_Color;
+    color.a *= alpha;
+
+    // Nearly invisible fade texels would still write depth and leave a halo that
+    // hides whatever is drawn behind the circle later
+    if (color.a < 0.02)
+        discard;
+}
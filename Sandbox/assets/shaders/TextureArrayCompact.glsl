@@ -0,0 +1,46 @@
+// Texture Array Shader, compact vertex format
+// Same packing as TextureCompact.glsl; the texture index selects the layer
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in uint a_TexIndexTiling;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+    v_Color = a_Color;
+    v_TexCoord = a_TexCoord;
+    v_TexIndex = float(a_TexIndexTiling & 0xFFFFu);
+    v_TilingFactor = float(a_TexIndexTiling >> 16) / 256.0;
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2DArray u_TextureArray;
+
+void main()
+{
+    color = texture(u_TextureArray, vec3(v_TexCoord * v_TilingFactor, v_TexIndex)) * v_Color;
+
+    // Fully transparent texels must not write depth and hide what is drawn behind later
+    if (color.a == 0.0)
+        discard;
+}
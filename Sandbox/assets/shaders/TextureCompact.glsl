@@ -0,0 +1,43 @@
+// Texture Shader, compact vertex format
+// Color and texcoords arrive normalized; the texture index (low 16 bits) and the
+// 8.8 fixed-point tiling factor (high 16 bits) share one integer attribute
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in uint a_TexIndexTiling;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out int v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+    v_Color = a_Color;
+    v_TexCoord = a_TexCoord;
+    v_TexIndex = int(a_TexIndexTiling & 0xFFFFu);
+    v_TilingFactor = float(a_TexIndexTiling >> 16) / 256.0;
+    gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in int v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2D u_Textures[16];
+
+void main()
+{
+    color = texture(u_Textures[v_TexIndex], v_TexCoord * v_TilingFactor) * v_Color;
+}
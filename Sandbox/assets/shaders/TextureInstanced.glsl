@@ -0,0 +1,52 @@
+// Instanced Texture Shader
+// One instance per quad; corners are expanded from a shared unit quad
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Corner;
+
+layout(location = 1) in vec3 i_Position;
+layout(location = 2) in vec2 i_Size;
+layout(location = 3) in vec2 i_Rotation; // cos, sin
+layout(location = 4) in vec4 i_Color;
+layout(location = 5) in vec4 i_TexRect;  // min uv, max uv
+layout(location = 6) in float i_TexIndex;
+layout(location = 7) in float i_TilingFactor;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+    vec2 local = a_Corner * i_Size;
+    vec2 rotated = vec2(local.x * i_Rotation.x - local.y * i_Rotation.y,
+                        local.x * i_Rotation.y + local.y * i_Rotation.x);
+
+    v_Color = i_Color;
+    v_TexCoord = mix(i_TexRect.xy, i_TexRect.zw, a_Corner + 0.5);
+    v_TexIndex = i_TexIndex;
+    v_TilingFactor = i_TilingFactor;
+    gl_Position = u_ViewProjection * vec4(i_Position.xy + rotated, i_Position.z, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2D u_Textures[16];
+
+void main()
+{
+    int index = int(v_TexIndex);
+    color = texture(u_Textures[index], v_TexCoord * v_TilingFactor) * v_Color;
+}
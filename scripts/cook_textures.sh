@@ -0,0 +1,58 @@
+#!/bin/bash
+
+# Offline cook step for GPU-compressed textures.
+#
+# Converts every PNG under a source directory into a block-compressed DDS with a full
+# mip chain, mirroring the directory layout. The engine loads the result through
+# Texture2D::Create("....dds"). Images are flipped first because the engine stores
+# rows bottom first.
+#
+# Requires ImageMagick (magick) and AMD Compressonator (compressonatorcli) on PATH.
+#
+# Usage: scripts/cook_textures.sh <source dir> <output dir> [BC1|BC3|BC7]
+#   BC1 - opaque or 1-bit alpha, 4 bits per pixel
+#   BC3 - smooth alpha, 8 bits per pixel
+#   BC7 - best quality, 8 bits per pixel, needs ARB_texture_compression_bptc (default)
+
+set -e
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 <source dir> <output dir> [BC1|BC3|BC7]"
+    exit 1
+fi
+
+SOURCE_DIR="$1"
+OUTPUT_DIR="$2"
+FORMAT="${3:-BC7}"
+
+case "$FORMAT" in
+    BC1|BC3|BC7) ;;
+    *) echo "Unknown format '$FORMAT', expected BC1, BC3 or BC7"; exit 1 ;;
+esac
+
+for tool in magick compressonatorcli; do
+    if ! command -v "$tool" &> /dev/null; then
+        echo "Missing '$tool', see the header of this script"
+        exit 1
+    fi
+done
+
+TEMP_DIR="$(mktemp -d)"
+trap 'rm -rf "$TEMP_DIR"' EXIT
+
+find "$SOURCE_DIR" -type f -iname '*.png' | while read -r source; do
+    relative="${source#$SOURCE_DIR/}"
+    output="$OUTPUT_DIR/${relative%.*}.dds"
+    mkdir -p "$(dirname "$output")"
+
+    # Skip images that are already cooked and up to date
+    if [ -f "$output" ] && [ "$output" -nt "$source" ]; then
+        continue
+    fi
+
+    echo "Cooking $relative -> $FORMAT"
+    magick "$source" -flip "$TEMP_DIR/flipped.png"
+    compressonatorcli -fd "$FORMAT" -miplevels 16 "$TEMP_DIR/flipped.png" "$output" > /dev/null
+done
+
+echo "Done"